@@ -0,0 +1,371 @@
+#ifndef ADJACENCY_LISTS_H
+#define ADJACENCY_LISTS_H
+
+#include <cstdint>
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+#include <type_traits>
+#include "edge_list.h"
+
+//how every adjacency list is organised:
+//ADJACENCY_UNORDERED - insertion order, lookups scan the list
+//ADJACENCY_SORTED - lists are kept sorted, lookups use a binary search
+//ADJACENCY_HASHED - insertion order plus a hash index of positions, deletion swaps the removed entry with the last one
+enum AdjacencyIndex{
+    ADJACENCY_UNORDERED,
+    ADJACENCY_SORTED,
+    ADJACENCY_HASHED
+};
+
+struct NoWeight{};
+
+#define ADJACENCY_NOT_FOUND UINT32_MAX
+
+//out-neighbours (and weights in a parallel array unless N is NoWeight) of every vertex
+template<typename N>
+class AdjacencyLists{
+private:
+    static constexpr bool weighted=!std::is_same<N, NoWeight>::value;
+
+    AdjacencyIndex index;
+    std::vector<std::vector<uint32_t>> targets;
+    std::vector<std::vector<N>> weights;
+    std::vector<std::unordered_multimap<uint32_t, uint32_t>> positions;
+
+    void removeAt(const uint32_t vertex, const uint32_t idx){
+        std::vector<uint32_t> &t=targets[vertex];
+        if(index==ADJACENCY_HASHED){
+            const uint32_t last=t.size()-1;
+            if(idx!=last){
+                auto range=positions[vertex].equal_range(t[last]);
+                for(auto it=range.first;it!=range.second;++it){
+                    if(it->second==last){
+                        it->second=idx;
+                        break;
+                    }
+                }
+                t[idx]=t[last];
+                if constexpr(weighted) weights[vertex][idx]=weights[vertex][last];
+            }
+            t.pop_back();
+            if constexpr(weighted) weights[vertex].pop_back();
+        }
+        else{
+            t.erase(t.begin()+idx);
+            if constexpr(weighted) weights[vertex].erase(weights[vertex].begin()+idx);
+        }
+    }
+
+    //entries before from are already sorted, the tail is sorted and merged with them
+    void sortList(const uint32_t vertex, const uint32_t from=0){
+        std::vector<uint32_t> &t=targets[vertex];
+        if(std::is_sorted(t.begin()+from, t.end()) && (from==0 || from==t.size() || t[from-1]<=t[from])) return;
+        if constexpr(weighted){
+            std::vector<N> &w=weights[vertex];
+            std::vector<std::pair<uint32_t, N>>tail;
+            tail.reserve(t.size()-from);
+            for(uint32_t i=from;i<t.size();++i) tail.push_back(std::pair<uint32_t, N>(t[i], w[i]));
+            std::stable_sort(tail.begin(), tail.end(), [](const std::pair<uint32_t, N> &a, const std::pair<uint32_t, N> &b){
+                return a.first<b.first;
+            });
+            //merging from the back keeps equal entries in their order and moves only the entries greater than the smallest new one
+            uint32_t head=from, k=t.size();
+            for(uint32_t j=tail.size();j>0;){
+                --k;
+                if(head>0 && t[head-1]>tail[j-1].first){
+                    --head;
+                    t[k]=t[head];
+                    w[k]=w[head];
+                }
+                else{
+                    --j;
+                    t[k]=tail[j].first;
+                    w[k]=tail[j].second;
+                }
+            }
+        }
+        else{
+            std::sort(t.begin()+from, t.end());
+            std::inplace_merge(t.begin(), t.begin()+from, t.end());
+        }
+    }
+
+    //entries before from are already in the index
+    void indexList(const uint32_t vertex, const uint32_t from=0){
+        if(from==0){
+            positions[vertex].clear();
+            positions[vertex].reserve(targets[vertex].size());
+        }
+        for(uint32_t i=from;i<targets[vertex].size();++i) positions[vertex].emplace(targets[vertex][i], i);
+    }
+
+    void rebuildList(const uint32_t vertex, const uint32_t from=0){
+        if(index==ADJACENCY_SORTED) sortList(vertex, from);
+        else if(index==ADJACENCY_HASHED) indexList(vertex, from);
+    }
+
+public:
+    AdjacencyLists(const uint32_t size, const AdjacencyIndex index) : targets(size){
+        this->index=index;
+        if constexpr(weighted) weights.resize(size);
+        if(index==ADJACENCY_HASHED) positions.resize(size);
+    }
+
+    AdjacencyIndex getIndex() const{
+        return index;
+    }
+
+    uint32_t getSize() const{
+        return targets.size();
+    }
+
+    uint32_t getDegree(const uint32_t vertex) const{
+        return targets[vertex].size();
+    }
+
+    const std::vector<uint32_t>& getTargets(const uint32_t vertex) const{
+        return targets[vertex];
+    }
+
+    const std::vector<N>& getWeights(const uint32_t vertex) const{
+        return weights[vertex];
+    }
+
+    uint32_t addVertex(){
+        targets.push_back(std::vector<uint32_t>());
+        if constexpr(weighted) weights.push_back(std::vector<N>());
+        if(index==ADJACENCY_HASHED) positions.push_back(std::unordered_multimap<uint32_t, uint32_t>());
+        return targets.size()-1;
+    }
+
+    //position of an entry equal to target or ADJACENCY_NOT_FOUND
+    uint32_t find(const uint32_t vertex, const uint32_t target) const{
+        const std::vector<uint32_t> &t=targets[vertex];
+        switch(index){
+            case ADJACENCY_SORTED:{
+                auto it=std::lower_bound(t.begin(), t.end(), target);
+                if(it!=t.end() && *it==target) return it-t.begin();
+            } break;
+            case ADJACENCY_HASHED:{
+                auto it=positions[vertex].find(target);
+                if(it!=positions[vertex].end()) return it->second;
+            } break;
+            default:{
+                for(uint32_t i=0;i<t.size();++i){
+                    if(t[i]==target) return i;
+                }
+            } break;
+        }
+        return ADJACENCY_NOT_FOUND;
+    }
+
+    bool contains(const uint32_t vertex, const uint32_t target) const{
+        return find(vertex, target)!=ADJACENCY_NOT_FOUND;
+    }
+
+    void insert(const uint32_t vertex, const uint32_t target, const N &weight=N()){
+        std::vector<uint32_t> &t=targets[vertex];
+        if(index==ADJACENCY_SORTED){
+            const uint32_t idx=std::upper_bound(t.begin(), t.end(), target)-t.begin();
+            t.insert(t.begin()+idx, target);
+            if constexpr(weighted) weights[vertex].insert(weights[vertex].begin()+idx, weight);
+            return;
+        }
+        if(index==ADJACENCY_HASHED) positions[vertex].emplace(target, t.size());
+        t.push_back(target);
+        if constexpr(weighted) weights[vertex].push_back(weight);
+    }
+
+    //removes every entry equal to target and returns how many were removed
+    uint32_t eraseAll(const uint32_t vertex, const uint32_t target){
+        std::vector<uint32_t> &t=targets[vertex];
+        switch(index){
+            case ADJACENCY_SORTED:{
+                auto range=std::equal_range(t.begin(), t.end(), target);
+                const uint32_t b=range.first-t.begin();
+                const uint32_t e=range.second-t.begin();
+                t.erase(range.first, range.second);
+                if constexpr(weighted) weights[vertex].erase(weights[vertex].begin()+b, weights[vertex].begin()+e);
+                return e-b;
+            }
+            case ADJACENCY_HASHED:{
+                auto range=positions[vertex].equal_range(target);
+                std::vector<uint32_t>found;
+                for(auto it=range.first;it!=range.second;++it) found.push_back(it->second);
+                positions[vertex].erase(range.first, range.second);
+                std::sort(found.begin(), found.end());
+                for(uint32_t i=found.size();i-->0;) removeAt(vertex, found[i]);
+                return found.size();
+            }
+            default:{
+                uint32_t out=0;
+                for(uint32_t i=0;i<t.size();++i){
+                    if(t[i]==target) continue;
+                    t[out]=t[i];
+                    if constexpr(weighted) weights[vertex][out]=weights[vertex][i];
+                    ++out;
+                }
+                const uint32_t result=t.size()-out;
+                t.resize(out);
+                if constexpr(weighted) weights[vertex].resize(out);
+                return result;
+            }
+        }
+    }
+
+    //removes one entry equal to (target, weight)
+    bool eraseOne(const uint32_t vertex, const uint32_t target, const N &weight){
+        std::vector<uint32_t> &t=targets[vertex];
+        switch(index){
+            case ADJACENCY_SORTED:{
+                auto range=std::equal_range(t.begin(), t.end(), target);
+                for(uint32_t i=range.first-t.begin();i<range.second-t.begin();++i){
+                    if(weights[vertex][i]==weight){
+                        removeAt(vertex, i);
+                        return true;
+                    }
+                }
+            } break;
+            case ADJACENCY_HASHED:{
+                auto range=positions[vertex].equal_range(target);
+                for(auto it=range.first;it!=range.second;++it){
+                    const uint32_t idx=it->second;
+                    if(weights[vertex][idx]==weight){
+                        positions[vertex].erase(it);
+                        removeAt(vertex, idx);
+                        return true;
+                    }
+                }
+            } break;
+            default:{
+                for(uint32_t i=0;i<t.size();++i){
+                    if(t[i]==target && weights[vertex][i]==weight){
+                        removeAt(vertex, i);
+                        return true;
+                    }
+                }
+            } break;
+        }
+        return false;
+    }
+
+    //the smallest weight among all entries equal to target, max if there are none
+    N minWeight(const uint32_t vertex, const uint32_t target, const N &max) const{
+        const std::vector<uint32_t> &t=targets[vertex];
+        N result=max;
+        switch(index){
+            case ADJACENCY_SORTED:{
+                for(uint32_t i=std::lower_bound(t.begin(), t.end(), target)-t.begin();i<t.size() && t[i]==target;++i){
+                    if(weights[vertex][i]<result) result=weights[vertex][i];
+                }
+            } break;
+            case ADJACENCY_HASHED:{
+                auto range=positions[vertex].equal_range(target);
+                for(auto it=range.first;it!=range.second;++it){
+                    if(weights[vertex][it->second]<result) result=weights[vertex][it->second];
+                }
+            } break;
+            default:{
+                for(uint32_t i=0;i<t.size();++i){
+                    if(t[i]==target && weights[vertex][i]<result) result=weights[vertex][i];
+                }
+            } break;
+        }
+        return result;
+    }
+
+    //sets the weight of the first entry equal to target (its old weight is written to previous), false if there is no such entry
+    bool updateWeight(const uint32_t vertex, const uint32_t target, const N &weight, N *previous=nullptr){
+        const uint32_t idx=find(vertex, target);
+        if(idx==ADJACENCY_NOT_FOUND) return false;
+        if(previous) *previous=weights[vertex][idx];
+        weights[vertex][idx]=weight;
+        return true;
+    }
+
+    //sets the weight of an entry equal to (target, previous), keeps two lists that describe the same parallel edges consistent
+    bool replaceWeight(const uint32_t vertex, const uint32_t target, const N &previous, const N &weight){
+        const std::vector<uint32_t> &t=targets[vertex];
+        if(index==ADJACENCY_HASHED){
+            auto range=positions[vertex].equal_range(target);
+            for(auto it=range.first;it!=range.second;++it){
+                if(weights[vertex][it->second]==previous){
+                    weights[vertex][it->second]=weight;
+                    return true;
+                }
+            }
+            return false;
+        }
+        uint32_t i=index==ADJACENCY_SORTED ? std::lower_bound(t.begin(), t.end(), target)-t.begin() : 0;
+        for(;i<t.size();++i){
+            if(t[i]==target && weights[vertex][i]==previous){
+                weights[vertex][i]=weight;
+                return true;
+            }
+            if(index==ADJACENCY_SORTED && t[i]!=target) break;
+        }
+        return false;
+    }
+
+    //edges have to be prepared by prepareEdges (edge_list.h), only the new entries of the lists of the endpoints are sorted or indexed
+    template<typename E>
+    void insertEdges(const std::vector<E> &edges, const bool symmetric, const bool skipExisting){
+        if(index==ADJACENCY_UNORDERED){
+            if constexpr(weighted) ::insertEdges(targets, weights, edges, symmetric, skipExisting);
+            else ::insertEdges(targets, edges, symmetric, skipExisting);
+            return;
+        }
+        std::vector<uint32_t>rows;
+        rows.reserve(symmetric ? 2*edges.size() : edges.size());
+        for(auto &e : edges){
+            const std::pair<uint32_t, uint32_t> &p=edgeEndpoints(e);
+            if(rows.empty() || rows.back()!=p.first) rows.push_back(p.first);
+            if(symmetric) rows.push_back(p.second);
+        }
+        std::sort(rows.begin(), rows.end());
+        rows.erase(std::unique(rows.begin(), rows.end()), rows.end());
+        std::vector<uint32_t>sizes(rows.size());
+        for(uint32_t i=0;i<rows.size();++i) sizes[i]=targets[rows[i]].size();
+        if constexpr(weighted) ::insertEdges(targets, weights, edges, symmetric, skipExisting);
+        else ::insertEdges(targets, edges, symmetric, skipExisting);
+        //new entries are appended, so only they are indexed or sorted and merged into the rest of the list
+        for(uint32_t i=0;i<rows.size();++i) rebuildList(rows[i], sizes[i]);
+    }
+
+    void rebuildIndex(){
+        for(uint32_t i=0;i<targets.size();++i) rebuildList(i);
+    }
+
+    //replaces the content with the transposition of other, the index mode stays the same
+    void assignTransposed(const AdjacencyLists<N> &other){
+        std::vector<uint32_t>degree(other.targets.size(), 0);
+        for(uint32_t i=0;i<other.targets.size();++i){
+            for(uint32_t j : other.targets[i]) ++degree[j];
+        }
+        std::vector<std::vector<uint32_t>> t_targets(other.targets.size());
+        std::vector<std::vector<N>> t_weights(other.weights.size());
+        for(uint32_t i=0;i<t_targets.size();++i){
+            t_targets[i].reserve(degree[i]);
+            if constexpr(weighted) t_weights[i].reserve(degree[i]);
+        }
+        for(uint32_t i=0;i<other.targets.size();++i){
+            for(uint32_t j=0;j<other.targets[i].size();++j){
+                t_targets[other.targets[i][j]].push_back(i);
+                if constexpr(weighted) t_weights[other.targets[i][j]].push_back(other.weights[i][j]);
+            }
+        }
+        targets.swap(t_targets);
+        weights.swap(t_weights);
+        if(index==ADJACENCY_HASHED) positions.resize(targets.size());
+        rebuildIndex();
+    }
+
+    void transpose(){
+        AdjacencyLists<N> tmp(0, index);
+        tmp.assignTransposed(*this);
+        std::swap(*this, tmp);
+    }
+};
+
+#endif
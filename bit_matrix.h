@@ -0,0 +1,196 @@
+#ifndef BIT_MATRIX_H
+#define BIT_MATRIX_H
+
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <algorithm>
+
+#define BIT_MATRIX_ALIGNMENT 64
+#define BIT_MATRIX_WORDS_PER_LINE 8
+
+inline uint32_t countTrailingZeros(const uint64_t word){
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(word);
+#else
+    uint32_t result=0;
+    while(!((word>>result)&1)) ++result;
+    return result;
+#endif
+}
+
+inline uint32_t countBits(uint64_t word){
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcountll(word);
+#else
+    uint32_t result=0;
+    while(word){
+        word&=word-1;
+        ++result;
+    }
+    return result;
+#endif
+}
+
+//square matrix of bits, every row starts on a new cache line and is padded to a whole number of cache lines
+class BitMatrix{
+private:
+    uint64_t *data;
+    uint32_t size;
+    uint32_t capacity;
+    uint32_t stride;
+
+    static uint32_t strideFor(const uint32_t capacity){
+        const uint32_t words=(capacity+63)/64;
+        return (words+BIT_MATRIX_WORDS_PER_LINE-1)/BIT_MATRIX_WORDS_PER_LINE*BIT_MATRIX_WORDS_PER_LINE;
+    }
+
+    static uint64_t *allocate(const uint64_t words){
+        if(words==0) return nullptr;
+        uint64_t *result=(uint64_t*)::operator new[](words*sizeof(uint64_t), std::align_val_t(BIT_MATRIX_ALIGNMENT));
+        std::memset(result, 0, words*sizeof(uint64_t));
+        return result;
+    }
+
+    static void release(uint64_t *ptr){
+        if(ptr) ::operator delete[](ptr, std::align_val_t(BIT_MATRIX_ALIGNMENT));
+    }
+
+    void reallocate(const uint32_t new_capacity){
+        const uint32_t new_stride=strideFor(new_capacity);
+        uint64_t *new_data=allocate((uint64_t)new_capacity*new_stride);
+        for(uint32_t i=0;i<this->size;++i){
+            std::memcpy(new_data+(uint64_t)i*new_stride, this->data+(uint64_t)i*this->stride, this->stride*sizeof(uint64_t));
+        }
+        release(this->data);
+        this->data=new_data;
+        this->capacity=new_capacity;
+        this->stride=new_stride;
+    }
+
+public:
+    BitMatrix(const uint32_t size){
+        this->size=size;
+        this->capacity=size;
+        this->stride=strideFor(size);
+        this->data=allocate((uint64_t)size*this->stride);
+    }
+
+    BitMatrix(const BitMatrix &other){
+        this->size=other.size;
+        this->capacity=other.capacity;
+        this->stride=other.stride;
+        this->data=allocate((uint64_t)other.capacity*other.stride);
+        if(this->data) std::memcpy(this->data, other.data, (uint64_t)other.size*other.stride*sizeof(uint64_t));
+    }
+
+    BitMatrix& operator=(const BitMatrix &other){
+        if(this==&other) return *this;
+        BitMatrix tmp(other);
+        std::swap(this->data, tmp.data);
+        std::swap(this->size, tmp.size);
+        std::swap(this->capacity, tmp.capacity);
+        std::swap(this->stride, tmp.stride);
+        return *this;
+    }
+
+    ~BitMatrix(){
+        release(this->data);
+    }
+
+    uint32_t getSize() const{
+        return this->size;
+    }
+
+    //number of words that hold columns <0;size), the rest of a row is padding
+    uint32_t getWordsInRow() const{
+        return (this->size+63)/64;
+    }
+
+    const uint64_t *getRow(const uint32_t row) const{
+        return this->data+(uint64_t)row*this->stride;
+    }
+
+    uint64_t *getRow(const uint32_t row){
+        return this->data+(uint64_t)row*this->stride;
+    }
+
+    bool get(const uint32_t row, const uint32_t column) const{
+        return (this->getRow(row)[column>>6]>>(column&63))&1;
+    }
+
+    void set(const uint32_t row, const uint32_t column){
+        this->getRow(row)[column>>6]|=(uint64_t)1<<(column&63);
+    }
+
+    void reset(const uint32_t row, const uint32_t column){
+        this->getRow(row)[column>>6]&=~((uint64_t)1<<(column&63));
+    }
+
+    //adds an empty row and an empty column, the capacity grows geometrically
+    uint32_t addRowAndColumn(){
+        if(this->size==this->capacity){
+            this->reallocate(std::max<uint32_t>(2*this->capacity, 64));
+        }
+        std::memset(this->getRow(this->size), 0, this->stride*sizeof(uint64_t));
+        return this->size++;
+    }
+
+    void transpose(){
+        for(uint32_t i=0;i<this->size;++i){
+            for(uint32_t j=i+1;j<this->size;++j){
+                const bool a=this->get(i, j);
+                const bool b=this->get(j, i);
+                if(a==b) continue;
+                if(a){
+                    this->reset(i, j);
+                    this->set(j, i);
+                }
+                else{
+                    this->set(i, j);
+                    this->reset(j, i);
+                }
+            }
+        }
+    }
+
+    uint32_t countRow(const uint32_t row) const{
+        const uint64_t *r=this->getRow(row);
+        uint32_t result=0;
+        for(uint32_t i=0;i<this->getWordsInRow();++i) result+=countBits(r[i]);
+        return result;
+    }
+
+    uint64_t count() const{
+        uint64_t result=0;
+        for(uint32_t i=0;i<this->size;++i) result+=this->countRow(i);
+        return result;
+    }
+
+    //number of columns set in both rows (for a graph: number of common neighbours)
+    uint32_t countCommon(const uint32_t row1, const uint32_t row2) const{
+        const uint64_t *r1=this->getRow(row1);
+        const uint64_t *r2=this->getRow(row2);
+        uint32_t result=0;
+        for(uint32_t i=0;i<this->getWordsInRow();++i) result+=countBits(r1[i]&r2[i]);
+        return result;
+    }
+
+    //out has to hold at least getWordsInRow() words
+    void andRow(const uint32_t row, uint64_t *out) const{
+        const uint64_t *r=this->getRow(row);
+        for(uint32_t i=0;i<this->getWordsInRow();++i) out[i]&=r[i];
+    }
+
+    void orRow(const uint32_t row, uint64_t *out) const{
+        const uint64_t *r=this->getRow(row);
+        for(uint32_t i=0;i<this->getWordsInRow();++i) out[i]|=r[i];
+    }
+
+    void andNotRow(const uint32_t row, uint64_t *out) const{
+        const uint64_t *r=this->getRow(row);
+        for(uint32_t i=0;i<this->getWordsInRow();++i) out[i]&=~r[i];
+    }
+};
+
+#endif
@@ -0,0 +1,498 @@
+#ifndef CONTRACTION_HIERARCHY_H
+#define CONTRACTION_HIERARCHY_H
+
+#include <cstdint>
+#include <vector>
+#include <atomic>
+#include <algorithm>
+#include "thread_pool.h"
+#include "search_workspace.h"
+#include "priority_queue.h"
+#include "error_info.h"
+
+#define CH_WITNESS_SETTLE_LIMIT 500
+#define CH_PARALLEL_CHUNK 64
+#define CH_NO_MIDDLE UINT32_MAX
+#define CH_WITNESS_TABLE_BITS 10
+
+template<typename N, typename PQ>
+class ContractionHierarchyQuery;
+
+//contraction hierarchy of a weighted graph (directed or undirected, weights can not be negative)
+//vertexes are contracted in rounds: every round takes the vertexes whose priority (edge difference + contracted neighbours + level)
+//is lower than the priority of all their neighbours, so they are independent and their witness searches run in parallel
+//after preprocessing every edge (original or shortcut) leads from a lower to a higher vertex in one of two CSR arrays:
+//up holds the edges v -> w of w above v, down holds the edges u -> v of u above v (stored at v); queries go through ContractionHierarchyQuery
+template<typename N>
+class ContractionHierarchy{
+public:
+    struct Arc{
+        uint32_t vertex;
+        N weight;
+        uint32_t middle;
+    };
+
+private:
+    struct Shortcut{
+        uint32_t from;
+        uint32_t to;
+        N weight;
+    };
+
+    //state of the witness searches of one thread; a search settles at most CH_WITNESS_SETTLE_LIMIT vertexes, so the vertexes it
+    //touches are kept in a small open addressing table that grows with the search and not in O(V) arrays per thread
+    class WitnessSearch{
+    public:
+        struct Entry{
+            uint32_t vertex;
+            N distance;
+            bool reached;
+            bool settled;
+            bool target;
+        };
+
+        //keys are slots of the table, not vertexes
+        IndexedDaryHeap<N>heap;
+        std::vector<Shortcut>shortcuts;
+
+    private:
+        //vertex UINT32_MAX marks an empty slot, used lists the taken slots so clear() does not scan the table
+        std::vector<Entry>slots;
+        std::vector<uint32_t>used;
+        uint32_t bits;
+
+        //slot that holds vertex or the empty slot where it should be put (linear probing)
+        uint32_t probe(const uint32_t vertex) const{
+            const uint32_t mask=(1u<<this->bits)-1;
+            uint32_t slot=(uint32_t)(((uint64_t)vertex*0x9E3779B97F4A7C15ull)>>(64-this->bits));
+            while(this->slots[slot].vertex!=UINT32_MAX && this->slots[slot].vertex!=vertex) slot=(slot+1)&mask;
+            return slot;
+        }
+
+        //doubles the table, slots change, so the heap is built again from the reached vertexes
+        void grow(){
+            std::vector<Entry>old(std::move(this->slots));
+            ++this->bits;
+            this->slots.assign((size_t)1<<this->bits, Entry{UINT32_MAX, N(), false, false, false});
+            this->heap.clear();
+            this->heap.resize(this->slots.size());
+            for(uint32_t &slot : this->used){
+                const Entry &e=old[slot];
+                slot=this->probe(e.vertex);
+                this->slots[slot]=e;
+                if(e.reached && !e.settled) this->heap.push(slot, e.distance);
+            }
+        }
+
+    public:
+        WitnessSearch() : heap(1<<CH_WITNESS_TABLE_BITS), slots((size_t)1<<CH_WITNESS_TABLE_BITS, Entry{UINT32_MAX, N(), false, false, false}){
+            this->bits=CH_WITNESS_TABLE_BITS;
+        }
+
+        //forgets the previous search in O(number of vertexes it touched)
+        void clear(){
+            for(const uint32_t slot : this->used) this->slots[slot].vertex=UINT32_MAX;
+            this->used.clear();
+            this->heap.clear();
+        }
+
+        Entry& at(const uint32_t slot){
+            return this->slots[slot];
+        }
+
+        //slot of vertex, UINT32_MAX if the search has not touched it
+        uint32_t find(const uint32_t vertex) const{
+            const uint32_t slot=this->probe(vertex);
+            return this->slots[slot].vertex==UINT32_MAX ? UINT32_MAX : slot;
+        }
+
+        //slot of vertex, a new (not reached) entry is added if there is none
+        uint32_t get(const uint32_t vertex){
+            uint32_t slot=this->probe(vertex);
+            if(this->slots[slot].vertex!=UINT32_MAX) return slot;
+            this->slots[slot]=Entry{vertex, N(), false, false, false};
+            this->used.push_back(slot);
+            if(2*this->used.size()>this->slots.size()){
+                this->grow();
+                slot=this->probe(vertex);
+            }
+            return slot;
+        }
+    };
+
+    uint32_t size;
+    N max;
+    uint64_t number_of_shortcuts;
+    std::vector<uint32_t>rank;
+    std::vector<uint64_t>up_offsets;
+    std::vector<uint64_t>down_offsets;
+    std::vector<Arc>up;
+    std::vector<Arc>down;
+
+    //adds from -> to or lowers its weight if the edge is already there
+    static void addArc(std::vector<std::vector<Arc>> &out, std::vector<std::vector<Arc>> &in, const uint32_t from, const uint32_t to, const N &weight, const uint32_t middle){
+        for(Arc &a : out[from]){
+            if(a.vertex!=to) continue;
+            if(weight<a.weight){
+                a.weight=weight;
+                a.middle=middle;
+                for(Arc &b : in[to]){
+                    if(b.vertex==from){
+                        b.weight=weight;
+                        b.middle=middle;
+                        break;
+                    }
+                }
+            }
+            return;
+        }
+        out[from].push_back(Arc{to, weight, middle});
+        in[to].push_back(Arc{from, weight, middle});
+    }
+
+    static void removeArc(std::vector<Arc> &arcs, const uint32_t vertex){
+        for(uint32_t i=0;i<arcs.size();++i){
+            if(arcs[i].vertex==vertex){
+                arcs[i]=arcs.back();
+                arcs.pop_back();
+                return;
+            }
+        }
+    }
+
+    //shortcuts needed to contract v: for every u -> v -> w a Dijkstra from u that skips v and every x with skip(x) looks for a path
+    //not longer than u -> v -> w, the search stops when every w is settled or after CH_WITNESS_SETTLE_LIMIT vertexes
+    //(a missing witness only adds a shortcut)
+    template<typename S>
+    static void findShortcuts(const std::vector<std::vector<Arc>> &out, const std::vector<std::vector<Arc>> &in, const uint32_t v,
+                              const S &skip, WitnessSearch &search, std::vector<Shortcut> &result){
+        result.clear();
+        if(in[v].empty() || out[v].empty()) return;
+        N longest=0;
+        for(const Arc &a : out[v]) longest=std::max(longest, a.weight);
+        IndexedDaryHeap<N> &heap=search.heap;
+        for(const Arc &first : in[v]){
+            const uint32_t u=first.vertex;
+            const N limit=first.weight+longest;
+            search.clear();
+            uint32_t targets=0;
+            for(const Arc &a : out[v]){
+                if(a.vertex==u) continue;
+                typename WitnessSearch::Entry &e=search.at(search.get(a.vertex));
+                if(!e.target){
+                    e.target=true;
+                    ++targets;
+                }
+            }
+            const uint32_t source=search.get(u);
+            search.at(source).distance=0;
+            search.at(source).reached=true;
+            heap.push(source, 0);
+            uint32_t settled=0;
+            while(!heap.empty() && targets && settled<CH_WITNESS_SETTLE_LIMIT){
+                const std::pair<uint32_t, N> top=heap.top();
+                if(limit<top.second) break;
+                heap.pop();
+                typename WitnessSearch::Entry &current=search.at(top.first);
+                current.settled=true;
+                ++settled;
+                if(current.target) --targets;
+                //get() below may move entries, the reference is not used after this point
+                for(const Arc &a : out[current.vertex]){
+                    if(a.vertex==v || skip(a.vertex)) continue;
+                    const N candidate=top.second+a.weight;
+                    const uint32_t index=search.get(a.vertex);
+                    typename WitnessSearch::Entry &e=search.at(index);
+                    if(e.settled || (e.reached && !(candidate<e.distance))) continue;
+                    e.distance=candidate;
+                    e.reached=true;
+                    heap.push(index, candidate);
+                }
+            }
+            for(const Arc &second : out[v]){
+                if(second.vertex==u) continue;
+                const N through=first.weight+second.weight;
+                const typename WitnessSearch::Entry &e=search.at(search.find(second.vertex));
+                if(e.reached && !(through<e.distance)) continue;
+                result.push_back(Shortcut{u, second.vertex, through});
+            }
+        }
+    }
+
+    //calls f(thread_id, index) for every index in <0;count), indexes are handed out in chunks
+    template<typename F>
+    static void parallelFor(ThreadPool &pool, const uint64_t count, const F &f){
+        std::atomic<uint64_t>next(0);
+        pool.run([&](const uint32_t id){
+            for(uint64_t b=next.fetch_add(CH_PARALLEL_CHUNK);b<count;b=next.fetch_add(CH_PARALLEL_CHUNK)){
+                const uint64_t e=std::min<uint64_t>(b+CH_PARALLEL_CHUNK, count);
+                for(uint64_t i=b;i<e;++i) f(id, i);
+            }
+        });
+    }
+
+    static void pack(const std::vector<std::vector<Arc>> &lists, std::vector<uint64_t> &offsets, std::vector<Arc> &arcs){
+        offsets.assign(lists.size()+1, 0);
+        for(uint32_t i=0;i<lists.size();++i) offsets[i+1]=offsets[i]+lists[i].size();
+        arcs.resize(offsets.back());
+        for(uint32_t i=0;i<lists.size();++i) std::copy(lists[i].begin(), lists[i].end(), arcs.begin()+offsets[i]);
+    }
+
+public:
+    //threads=0 uses every hardware thread
+    template<typename G>
+    explicit ContractionHierarchy(const G &g, const uint32_t threads=0){
+        this->size=g.getSize();
+        this->max=g.getMax();
+        this->number_of_shortcuts=0;
+        this->rank=std::vector<uint32_t>(this->size, UINT32_MAX);
+        const uint32_t size=this->size;
+        std::vector<std::vector<Arc>>out(size), in(size), final_up(size), final_down(size);
+        for(uint32_t i=0;i<size;++i){
+            for(const auto &j : g.getNeighboursWithWeightsRange(i)){
+                if(j.second<0){
+                    printErrorMsg(2, "ContractionHierarchy can not be built for a graph with negative weights.");
+                }
+                if(j.first!=i) addArc(out, in, i, j.first, j.second, CH_NO_MIDDLE);
+            }
+        }
+
+        ThreadPool pool(threads);
+        std::vector<WitnessSearch>searches(pool.getSize());
+        std::vector<int64_t>priority(size, 0);
+        std::vector<uint32_t>contracted_neighbours(size, 0), level(size, 0), in_round(size, 0), dirty_round(size, 0);
+        auto updatePriority=[&](const uint32_t id, const uint32_t v){
+            findShortcuts(out, in, v, [](const uint32_t){return false;}, searches[id], searches[id].shortcuts);
+            priority[v]=(int64_t)searches[id].shortcuts.size()-(int64_t)(in[v].size()+out[v].size())+contracted_neighbours[v]+level[v];
+        };
+        //ties are broken by a hash of the number, so neighbouring numbers are not contracted in long chains
+        auto isBefore=[&](const uint32_t a, const uint32_t b){
+            if(priority[a]!=priority[b]) return priority[a]<priority[b];
+            const uint32_t ha=a*2654435761u, hb=b*2654435761u;
+            return ha!=hb ? ha<hb : a<b;
+        };
+
+        std::vector<uint32_t>remaining(size), independent, dirty;
+        for(uint32_t i=0;i<size;++i) remaining[i]=i;
+        parallelFor(pool, size, [&](const uint32_t id, const uint64_t i){
+            updatePriority(id, i);
+        });
+        std::vector<std::vector<Shortcut>>shortcuts;
+        uint32_t next_rank=0, round=0;
+        while(!remaining.empty()){
+            ++round;
+            independent.clear();
+            for(uint32_t v : remaining){
+                bool minimal=true;
+                for(const Arc &a : out[v]) minimal=minimal && isBefore(v, a.vertex);
+                for(const Arc &a : in[v]) minimal=minimal && isBefore(v, a.vertex);
+                if(minimal){
+                    independent.push_back(v);
+                    in_round[v]=round;
+                }
+            }
+            //vertexes contracted in this round are skipped by all witness searches of the round
+            if(shortcuts.size()<independent.size()) shortcuts.resize(independent.size());
+            parallelFor(pool, independent.size(), [&](const uint32_t id, const uint64_t i){
+                findShortcuts(out, in, independent[i], [&](const uint32_t x){return in_round[x]==round;}, searches[id], shortcuts[i]);
+            });
+
+            dirty.clear();
+            for(uint32_t i=0;i<independent.size();++i){
+                const uint32_t v=independent[i];
+                this->rank[v]=next_rank++;
+                auto touch=[&](const uint32_t u){
+                    if(dirty_round[u]!=round){
+                        dirty_round[u]=round;
+                        dirty.push_back(u);
+                    }
+                    ++contracted_neighbours[u];
+                    level[u]=std::max(level[u], level[v]+1);
+                };
+                for(const Arc &a : out[v]){
+                    removeArc(in[a.vertex], v);
+                    touch(a.vertex);
+                }
+                for(const Arc &a : in[v]){
+                    removeArc(out[a.vertex], v);
+                    touch(a.vertex);
+                }
+                for(const Shortcut &s : shortcuts[i]) addArc(out, in, s.from, s.to, s.weight, v);
+                this->number_of_shortcuts+=shortcuts[i].size();
+                final_up[v].swap(out[v]);
+                final_down[v].swap(in[v]);
+                std::vector<Arc>().swap(out[v]);
+                std::vector<Arc>().swap(in[v]);
+            }
+            remaining.erase(std::remove_if(remaining.begin(), remaining.end(), [&](const uint32_t v){
+                return this->rank[v]!=UINT32_MAX;
+            }), remaining.end());
+            parallelFor(pool, dirty.size(), [&](const uint32_t id, const uint64_t i){
+                updatePriority(id, dirty[i]);
+            });
+        }
+        pack(final_up, this->up_offsets, this->up);
+        pack(final_down, this->down_offsets, this->down);
+    }
+
+    uint32_t getSize() const{
+        return this->size;
+    }
+
+    N getMax() const{
+        return this->max;
+    }
+
+    //position of the vertex in the contraction order
+    uint32_t getRank(const uint32_t vertex) const{
+        return this->rank[vertex];
+    }
+
+    uint64_t getNumberOfShortcuts() const{
+        return this->number_of_shortcuts;
+    }
+
+    //edges vertex -> w with w above vertex
+    const Arc *getUpBegin(const uint32_t vertex) const{
+        return this->up.data()+this->up_offsets[vertex];
+    }
+
+    const Arc *getUpEnd(const uint32_t vertex) const{
+        return this->up.data()+this->up_offsets[vertex+1];
+    }
+
+    //edges u -> vertex with u above vertex (Arc::vertex is u)
+    const Arc *getDownBegin(const uint32_t vertex) const{
+        return this->down.data()+this->down_offsets[vertex];
+    }
+
+    const Arc *getDownEnd(const uint32_t vertex) const{
+        return this->down.data()+this->down_offsets[vertex+1];
+    }
+
+    //the middle vertex of from -> to (CH_NO_MIDDLE for an original edge), the edge has to exist in the hierarchy
+    uint32_t getMiddle(const uint32_t from, const uint32_t to) const{
+        if(this->rank[from]<this->rank[to]){
+            for(const Arc *a=this->getUpBegin(from);a!=this->getUpEnd(from);++a){
+                if(a->vertex==to) return a->middle;
+            }
+        }
+        else{
+            for(const Arc *a=this->getDownBegin(to);a!=this->getDownEnd(to);++a){
+                if(a->vertex==from) return a->middle;
+            }
+        }
+        return CH_NO_MIDDLE;
+    }
+};
+
+//point-to-point queries on a contraction hierarchy: a forward search from src over up edges and a backward search from destination
+//over down edges, both only go up in the hierarchy; a vertex is not expanded if an edge from a vertex above proves its distance
+//too large (stall-on-demand); buffers are reused between queries, one object should be used by one thread at a time
+template<typename N, typename PQ=IndexedDaryHeap<N>>
+class ContractionHierarchyQuery{
+private:
+    const ContractionHierarchy<N> &ch;
+    SearchWorkspace<N, PQ>forward;
+    SearchWorkspace<N, PQ>backward;
+    std::vector<std::pair<uint32_t, uint32_t>>stack;
+    std::vector<uint32_t>hierarchy_path;
+    uint32_t meeting;
+
+    typedef typename ContractionHierarchy<N>::Arc Arc;
+
+    //settles the smallest vertex of one direction, returns false if that direction is finished
+    bool step(SearchWorkspace<N, PQ> &self, const SearchWorkspace<N, PQ> &other, const bool is_forward, N &best){
+        PQ &pq=self.getQueue();
+        if(pq.empty()) return false;
+        const std::pair<uint32_t, N> top=pq.top();
+        if(!(top.second<best)){
+            pq.clear();
+            return false;
+        }
+        pq.pop();
+        const uint32_t v=top.first;
+        self.settle(v);
+        if(other.isReached(v) && top.second+other.getDistance(v)<best){
+            best=top.second+other.getDistance(v);
+            this->meeting=v;
+        }
+        const Arc *stall_begin=is_forward ? this->ch.getDownBegin(v) : this->ch.getUpBegin(v);
+        const Arc *stall_end=is_forward ? this->ch.getDownEnd(v) : this->ch.getUpEnd(v);
+        for(const Arc *a=stall_begin;a!=stall_end;++a){
+            if(self.isReached(a->vertex) && self.getDistance(a->vertex)+a->weight<top.second) return true;
+        }
+        const Arc *begin=is_forward ? this->ch.getUpBegin(v) : this->ch.getDownBegin(v);
+        const Arc *end=is_forward ? this->ch.getUpEnd(v) : this->ch.getDownEnd(v);
+        for(const Arc *a=begin;a!=end;++a){
+            const N candidate=top.second+a->weight;
+            if(!self.isSettled(a->vertex) && (!self.isReached(a->vertex) || candidate<self.getDistance(a->vertex))){
+                self.reach(a->vertex, candidate, v);
+                pq.push(a->vertex, candidate);
+            }
+        }
+        return true;
+    }
+
+    //appends the original vertexes of from -> to without from
+    void unpack(const uint32_t from, const uint32_t to, std::vector<uint32_t> &path){
+        this->stack.clear();
+        this->stack.push_back(std::pair<uint32_t, uint32_t>(from, to));
+        while(!this->stack.empty()){
+            const std::pair<uint32_t, uint32_t> edge=this->stack.back();
+            this->stack.pop_back();
+            const uint32_t middle=this->ch.getMiddle(edge.first, edge.second);
+            if(middle==CH_NO_MIDDLE){
+                path.push_back(edge.second);
+                continue;
+            }
+            this->stack.push_back(std::pair<uint32_t, uint32_t>(middle, edge.second));
+            this->stack.push_back(std::pair<uint32_t, uint32_t>(edge.first, middle));
+        }
+    }
+
+public:
+    explicit ContractionHierarchyQuery(const ContractionHierarchy<N> &ch) : ch(ch), forward(ch.getSize()), backward(ch.getSize()){
+        this->meeting=UINT32_MAX;
+    }
+
+    //returns getMax() of the graph if destination can not be reached
+    N getDistance(const uint32_t src, const uint32_t destination){
+        if(src>=this->ch.getSize()){
+            printErrorMsg(2, "Agrument src in method ContractionHierarchyQuery::getDistance(const uint32_t, const uint32_t) is outside of the graph.");
+        }
+        if(destination>=this->ch.getSize()){
+            printErrorMsg(2, "Agrument destination in method ContractionHierarchyQuery::getDistance(const uint32_t, const uint32_t) is outside of the graph.");
+        }
+        this->forward.reset();
+        this->backward.reset();
+        this->meeting=UINT32_MAX;
+        N best=this->ch.getMax();
+        this->forward.reach(src, 0, UINT32_MAX);
+        this->forward.getQueue().push(src, 0);
+        this->backward.reach(destination, 0, UINT32_MAX);
+        this->backward.getQueue().push(destination, 0);
+        bool forward_running=true, backward_running=true;
+        while(forward_running || backward_running){
+            if(forward_running) forward_running=this->step(this->forward, this->backward, true, best);
+            if(backward_running) backward_running=this->step(this->backward, this->forward, false, best);
+        }
+        return best;
+    }
+
+    //writes the path in the original graph, returns false if there is no path
+    bool getPath(const uint32_t src, const uint32_t destination, std::vector<uint32_t> &path){
+        path.clear();
+        this->getDistance(src, destination);
+        if(this->meeting==UINT32_MAX) return false;
+        this->hierarchy_path.clear();
+        for(uint32_t v=this->meeting;v!=UINT32_MAX;v=this->forward.getParent(v)) this->hierarchy_path.push_back(v);
+        std::reverse(this->hierarchy_path.begin(), this->hierarchy_path.end());
+        for(uint32_t v=this->backward.getParent(this->meeting);v!=UINT32_MAX;v=this->backward.getParent(v)) this->hierarchy_path.push_back(v);
+        path.push_back(this->hierarchy_path[0]);
+        for(uint32_t i=1;i<this->hierarchy_path.size();++i) this->unpack(this->hierarchy_path[i-1], this->hierarchy_path[i], path);
+        return true;
+    }
+};
+
+#endif
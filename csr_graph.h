@@ -0,0 +1,553 @@
+#ifndef CSR_GRAPH_H
+#define CSR_GRAPH_H
+
+#include <cstdint>
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include "neighbour_range.h"
+#include "edge_list.h"
+#include "error_info.h"
+
+//arrays of a CSR graph that live outside of the graph (e.g. in a mapped file), owner keeps them alive
+struct CSRView{
+    std::shared_ptr<const void> owner;
+    uint32_t size;
+    uint64_t number_of_edges;
+    const uint64_t *offsets;
+    const uint32_t *targets;
+    const void *weights;
+};
+
+class CSRGraphBase{
+protected:
+    bool is_directed;
+    bool is_weighted;
+    uint32_t size;
+    uint64_t number_of_edges;
+    //offsets and targets point either to the vectors below or to external memory kept alive by owner
+    const uint64_t *offsets;
+    const uint32_t *targets;
+    std::vector<uint64_t>offsets_storage;
+    std::vector<uint32_t>targets_storage;
+    std::shared_ptr<const void> owner;
+
+    bool isIndexOutOfBounds(const uint32_t idx) const{
+        if(idx>=this->getSize()) return true;
+        return false;
+    }
+
+    CSRGraphBase(){
+        this->size=0;
+        this->number_of_edges=0;
+        this->offsets=nullptr;
+        this->targets=nullptr;
+    }
+
+    CSRGraphBase(const CSRGraphBase &other){
+        *this=other;
+    }
+
+    CSRGraphBase& operator=(const CSRGraphBase &other){
+        if(this==&other) return *this;
+        this->is_directed=other.is_directed;
+        this->is_weighted=other.is_weighted;
+        this->size=other.size;
+        this->number_of_edges=other.number_of_edges;
+        this->offsets_storage=other.offsets_storage;
+        this->targets_storage=other.targets_storage;
+        this->owner=other.owner;
+        if(this->owner){
+            this->offsets=other.offsets;
+            this->targets=other.targets;
+        }
+        else this->attachStorage();
+        return *this;
+    }
+
+    void attachStorage(){
+        this->owner.reset();
+        this->offsets=this->offsets_storage.data();
+        this->targets=this->targets_storage.data();
+    }
+
+    void attachView(const CSRView &view){
+        this->owner=view.owner;
+        this->size=view.size;
+        this->number_of_edges=view.number_of_edges;
+        this->offsets=view.offsets;
+        this->targets=view.targets;
+    }
+
+    //fills offsets and returns the write cursor of every row, symmetric adds every edge in both directions
+    template<typename E>
+    std::vector<uint64_t> countDegrees(const uint32_t size, const std::vector<E> &edges, const bool symmetric){
+        this->size=size;
+        this->offsets_storage=std::vector<uint64_t>(size+1, 0);
+        this->number_of_edges=edges.size();
+        for(auto &e : edges){
+            const std::pair<uint32_t, uint32_t> &p=edgeEndpoints(e);
+            ++this->offsets_storage[p.first+1];
+            if(symmetric && p.first!=p.second) ++this->offsets_storage[p.second+1];
+        }
+        for(uint32_t i=0;i<size;++i) this->offsets_storage[i+1]+=this->offsets_storage[i];
+        this->targets_storage=std::vector<uint32_t>(this->offsets_storage[size]);
+        this->attachStorage();
+        return std::vector<uint64_t>(this->offsets_storage.begin(), this->offsets_storage.end()-1);
+    }
+
+    //takes over arrays built elsewhere, is_directed has to be set (an undirected graph stores every edge in both of its rows)
+    void adoptStorage(std::vector<uint64_t> &offsets, std::vector<uint32_t> &targets){
+        if(offsets.empty() || offsets.size()-1>=UINT32_MAX || offsets[0]!=0 || offsets.back()!=targets.size()){
+            printErrorMsg(2, "The arrays passed to a constructor of a class that represents CSR graph are inconsistent.");
+        }
+        this->size=offsets.size()-1;
+        this->offsets_storage.swap(offsets);
+        this->targets_storage.swap(targets);
+        this->attachStorage();
+        this->number_of_edges=this->offsets[this->size];
+        if(!this->is_directed){
+            uint64_t loops=0;
+            for(uint32_t i=0;i<this->size;++i){
+                for(uint64_t j=this->offsets[i];j<this->offsets[i+1];++j) loops+=this->targets[j]==i;
+            }
+            this->number_of_edges=(this->number_of_edges+loops)/2;
+        }
+    }
+
+    template<typename E>
+    void checkEdges(const uint32_t size, const std::vector<E> &edges) const{
+        if(!areEdgesInBounds(edges, size)){
+            printErrorMsg(2, "One of the edges passed to a constructor of a class that represents CSR graph is out of bounds.");
+        }
+    }
+
+    template<typename E>
+    void fillTargets(const uint32_t size, const std::vector<E> &edges, const bool symmetric){
+        std::vector<uint64_t>cursor=this->countDegrees(size, edges, symmetric);
+        for(auto &e : edges){
+            const std::pair<uint32_t, uint32_t> &p=edgeEndpoints(e);
+            this->targets_storage[cursor[p.first]++]=p.second;
+            if(symmetric && p.first!=p.second) this->targets_storage[cursor[p.second]++]=p.first;
+        }
+        for(uint32_t i=0;i<this->getSize();++i){
+            auto b=this->targets_storage.begin()+this->offsets[i];
+            auto e=this->targets_storage.begin()+this->offsets[i+1];
+            if(!std::is_sorted(b, e)) std::sort(b, e);
+        }
+    }
+
+    //rows are kept sorted, so the first entry equal to second is found by a binary search
+    uint64_t findEdge(const uint32_t first, const uint32_t second) const{
+        return std::lower_bound(this->targets+this->offsets[first], this->targets+this->offsets[first+1], second)-this->targets;
+    }
+
+    void transposeTargets(){
+        const uint32_t size=this->getSize();
+        const uint64_t entries=this->offsets[size];
+        std::vector<uint64_t>t_offsets(size+1, 0);
+        for(uint64_t i=0;i<entries;++i) ++t_offsets[this->targets[i]+1];
+        for(uint32_t i=0;i<size;++i) t_offsets[i+1]+=t_offsets[i];
+        std::vector<uint32_t>t_targets(entries);
+        std::vector<uint64_t>cursor(t_offsets.begin(), t_offsets.end()-1);
+        for(uint32_t i=0;i<size;++i){
+            for(uint64_t j=this->offsets[i];j<this->offsets[i+1];++j){
+                t_targets[cursor[this->targets[j]]++]=i;
+            }
+        }
+        this->offsets_storage.swap(t_offsets);
+        this->targets_storage.swap(t_targets);
+        this->attachStorage();
+    }
+
+public:
+    bool isDirected() const{
+        return this->is_directed;
+    }
+
+    bool isWeighted() const{
+        return this->is_weighted;
+    }
+
+    uint32_t getSize() const{
+        return this->size;
+    }
+
+    uint64_t getNumberOfEdges() const{
+        return this->number_of_edges;
+    }
+
+    //true if the arrays are not owned by the graph (e.g. the graph was loaded by mapBinaryGraph)
+    bool isMapped() const{
+        return this->owner!=nullptr;
+    }
+
+    //raw arrays: getOffsets() has getSize()+1 entries, getTargets() has getOffsets()[getSize()] entries
+    const uint64_t *getOffsets() const{
+        return this->offsets;
+    }
+
+    const uint32_t *getTargets() const{
+        return this->targets;
+    }
+
+    void transpose(){
+        return;
+    }
+
+    bool areVertexesConnected(const uint32_t first, const uint32_t second) const{
+        if(this->isIndexOutOfBounds(first)){
+            printErrorMsg(2, "The first argument of a method areVertexesConnected(const uint32_t, const uint32_t) in a class that represents CSR graph is out of bounds.");
+        }
+        if(this->isIndexOutOfBounds(second)){
+            printErrorMsg(2, "The second argument of a method areVertexesConnected(const uint32_t, const uint32_t) in a class that represents CSR graph is out of bounds.");
+        }
+        const uint64_t idx=this->findEdge(first, second);
+        return idx<this->offsets[first+1] && this->targets[idx]==second;
+    }
+
+    const NeighbourRange getNeighbours(const uint32_t vertex) const{
+        if(this->isIndexOutOfBounds(vertex)){
+            printErrorMsg(2, "The argument of a method getNeighbours(const uint32_t) in a class that represents CSR graph is out of bounds.");
+        }
+        return NeighbourRange(this->targets+this->offsets[vertex], this->targets+this->offsets[vertex+1]);
+    }
+
+    const NeighbourRange getNeighboursRange(const uint32_t vertex) const{
+        return this->getNeighbours(vertex);
+    }
+};
+
+template<typename N>
+class CSRWeightedGraphBase : public CSRGraphBase{
+protected:
+    N max;
+    const N *weights;
+    std::vector<N>weights_storage;
+
+    CSRWeightedGraphBase(){
+        this->weights=nullptr;
+    }
+
+    CSRWeightedGraphBase(const CSRWeightedGraphBase &other) : CSRGraphBase(other){
+        this->max=other.max;
+        this->weights_storage=other.weights_storage;
+        this->weights=this->owner ? other.weights : this->weights_storage.data();
+    }
+
+    CSRWeightedGraphBase& operator=(const CSRWeightedGraphBase &other){
+        if(this==&other) return *this;
+        CSRGraphBase::operator=(other);
+        this->max=other.max;
+        this->weights_storage=other.weights_storage;
+        this->weights=this->owner ? other.weights : this->weights_storage.data();
+        return *this;
+    }
+
+    void adoptStorage(std::vector<uint64_t> &offsets, std::vector<uint32_t> &targets, std::vector<N> &weights, const N &max){
+        if(weights.size()!=targets.size()){
+            printErrorMsg(2, "The arrays passed to a constructor of a class that represents weighted CSR graph are inconsistent.");
+        }
+        CSRGraphBase::adoptStorage(offsets, targets);
+        this->max=max;
+        this->weights_storage.swap(weights);
+        this->weights=this->weights_storage.data();
+    }
+
+    void attachView(const CSRView &view, const N &max){
+        CSRGraphBase::attachView(view);
+        this->max=max;
+        this->weights=(const N*)view.weights;
+    }
+
+    template<typename W>
+    void fillTargetsAndWeights(const uint32_t size, const std::vector<std::pair<std::pair<uint32_t, uint32_t>, W>> &edges, const bool symmetric){
+        std::vector<uint64_t>cursor=this->countDegrees(size, edges, symmetric);
+        this->weights_storage=std::vector<N>(this->targets_storage.size());
+        this->weights=this->weights_storage.data();
+        for(auto &e : edges){
+            uint64_t idx=cursor[e.first.first]++;
+            this->targets_storage[idx]=e.first.second;
+            this->weights_storage[idx]=e.second;
+            if(symmetric && e.first.first!=e.first.second){
+                idx=cursor[e.first.second]++;
+                this->targets_storage[idx]=e.first.first;
+                this->weights_storage[idx]=e.second;
+            }
+        }
+        std::vector<std::pair<uint32_t, N>>row;
+        for(uint32_t i=0;i<this->getSize();++i){
+            const uint64_t b=this->offsets[i];
+            const uint64_t e=this->offsets[i+1];
+            if(std::is_sorted(this->targets_storage.begin()+b, this->targets_storage.begin()+e)) continue;
+            row.clear();
+            for(uint64_t j=b;j<e;++j) row.push_back(std::pair<uint32_t, N>(this->targets_storage[j], this->weights_storage[j]));
+            std::sort(row.begin(), row.end());
+            for(uint64_t j=b;j<e;++j){
+                this->targets_storage[j]=row[j-b].first;
+                this->weights_storage[j]=row[j-b].second;
+            }
+        }
+    }
+
+    void transposeTargetsAndWeights(){
+        const uint32_t size=this->getSize();
+        const uint64_t entries=this->offsets[size];
+        std::vector<uint64_t>t_offsets(size+1, 0);
+        for(uint64_t i=0;i<entries;++i) ++t_offsets[this->targets[i]+1];
+        for(uint32_t i=0;i<size;++i) t_offsets[i+1]+=t_offsets[i];
+        std::vector<uint32_t>t_targets(entries);
+        std::vector<N>t_weights(entries);
+        std::vector<uint64_t>cursor(t_offsets.begin(), t_offsets.end()-1);
+        for(uint32_t i=0;i<size;++i){
+            for(uint64_t j=this->offsets[i];j<this->offsets[i+1];++j){
+                const uint64_t idx=cursor[this->targets[j]]++;
+                t_targets[idx]=i;
+                t_weights[idx]=this->weights[j];
+            }
+        }
+        this->offsets_storage.swap(t_offsets);
+        this->targets_storage.swap(t_targets);
+        this->weights_storage.swap(t_weights);
+        this->attachStorage();
+        this->weights=this->weights_storage.data();
+    }
+
+public:
+    N getMax() const{
+        return this->max;
+    }
+
+    //weights of the edges, parallel to getTargets()
+    const N *getWeights() const{
+        return this->weights;
+    }
+
+    const WeightedNeighbourRange<N> getNeighboursWithWeights(const uint32_t vertex) const{
+        if(this->isIndexOutOfBounds(vertex)){
+            printErrorMsg(2, "The argument of a method getNeighboursWithWeights(const uint32_t) in a class that represents weighted CSR graph is out of bounds.");
+        }
+        const uint64_t b=this->offsets[vertex];
+        return WeightedNeighbourRange<N>(this->targets+b, this->weights+b, this->offsets[vertex+1]-b);
+    }
+
+    const WeightedNeighbourRange<N> getNeighboursWithWeightsRange(const uint32_t vertex) const{
+        return this->getNeighboursWithWeights(vertex);
+    }
+
+    N getWeight(const uint32_t first, const uint32_t second) const{
+        if(this->isIndexOutOfBounds(first)){
+            printErrorMsg(2, "The first argument of a method getWeight(const uint32_t, const uint32_t) in a class that represents weighted CSR graph is out of bounds.");
+        }
+        if(this->isIndexOutOfBounds(second)){
+            printErrorMsg(2, "The second argument of a method getWeight(const uint32_t, const uint32_t) in a class that represents weighted CSR graph is out of bounds.");
+        }
+        N result=this->max;
+        for(uint64_t i=this->findEdge(first, second);i<this->offsets[first+1] && this->targets[i]==second;++i){
+            if(this->weights[i]<result) result=this->weights[i];
+        }
+        return result;
+    }
+
+    const std::vector<std::pair<std::pair<uint32_t, uint32_t>, N>> getListOfEdges() const{
+        std::vector<std::pair<std::pair<uint32_t, uint32_t>, N>>result;
+        result.reserve(this->number_of_edges);
+        for(uint32_t i=0;i<this->getSize();++i){
+            for(uint64_t j=this->offsets[i];j<this->offsets[i+1];++j){
+                if(this->is_directed || i<=this->targets[j]){
+                    result.push_back(std::pair<std::pair<uint32_t, uint32_t>, N>(std::pair<uint32_t, uint32_t>(i, this->targets[j]), this->weights[j]));
+                }
+            }
+        }
+        return result;
+    }
+};
+
+class CSRGraphDirected : public CSRGraphBase{
+public:
+    template<typename G>
+    explicit CSRGraphDirected(const G &g){
+        this->is_directed=true;
+        this->is_weighted=false;
+        this->fillTargets(g.getSize(), g.getListOfEdges(), !g.isDirected());
+        if(!g.isDirected()) this->number_of_edges=this->offsets[this->size];
+    }
+
+    //builds the graph straight from an edge list, deduplicate keeps only the last occurrence of every edge
+    CSRGraphDirected(const uint32_t size, std::vector<std::pair<uint32_t, uint32_t>> edges, const bool deduplicate=false){
+        this->is_directed=true;
+        this->is_weighted=false;
+        this->checkEdges(size, edges);
+        if(deduplicate) prepareEdges(edges, false, true);
+        this->fillTargets(size, edges, false);
+    }
+
+    //takes over arrays that are already in the CSR form (e.g. built by the readers from graph_reader.h), every row has to be sorted
+    CSRGraphDirected(std::vector<uint64_t> &&offsets, std::vector<uint32_t> &&targets){
+        this->is_directed=true;
+        this->is_weighted=false;
+        this->adoptStorage(offsets, targets);
+    }
+
+    //uses external arrays without copying them
+    explicit CSRGraphDirected(const CSRView &view){
+        this->is_directed=true;
+        this->is_weighted=false;
+        this->attachView(view);
+    }
+
+    ~CSRGraphDirected()=default;
+
+    void transpose(){
+        this->transposeTargets();
+    }
+
+    const std::vector<std::pair<uint32_t, uint32_t>> getListOfEdges() const{
+        std::vector<std::pair<uint32_t, uint32_t>>result;
+        result.reserve(this->number_of_edges);
+        for(uint32_t i=0;i<this->getSize();++i){
+            for(uint64_t j=this->offsets[i];j<this->offsets[i+1];++j){
+                result.push_back(std::pair<uint32_t, uint32_t>(i, this->targets[j]));
+            }
+        }
+        return result;
+    }
+};
+
+class CSRGraph : public CSRGraphBase{
+public:
+    //arcs u -> v and v -> u (and parallel arcs) of a directed g become a single edge
+    template<typename G>
+    explicit CSRGraph(const G &g){
+        this->is_directed=false;
+        this->is_weighted=false;
+        auto edges=g.getListOfEdges();
+        if(g.isDirected()) prepareEdges(edges, true, true);
+        this->fillTargets(g.getSize(), edges, true);
+    }
+
+    //builds the graph straight from an edge list, deduplicate keeps only the last occurrence of every edge
+    CSRGraph(const uint32_t size, std::vector<std::pair<uint32_t, uint32_t>> edges, const bool deduplicate=false){
+        this->is_directed=false;
+        this->is_weighted=false;
+        this->checkEdges(size, edges);
+        if(deduplicate) prepareEdges(edges, true, true);
+        this->fillTargets(size, edges, true);
+    }
+
+    //takes over arrays that are already in the CSR form, every row has to be sorted and every edge has to be in the rows of both endpoints
+    CSRGraph(std::vector<uint64_t> &&offsets, std::vector<uint32_t> &&targets){
+        this->is_directed=false;
+        this->is_weighted=false;
+        this->adoptStorage(offsets, targets);
+    }
+
+    //uses external arrays without copying them
+    explicit CSRGraph(const CSRView &view){
+        this->is_directed=false;
+        this->is_weighted=false;
+        this->attachView(view);
+    }
+
+    ~CSRGraph()=default;
+
+    const std::vector<std::pair<uint32_t, uint32_t>> getListOfEdges() const{
+        std::vector<std::pair<uint32_t, uint32_t>>result;
+        result.reserve(this->number_of_edges);
+        for(uint32_t i=0;i<this->getSize();++i){
+            for(uint64_t j=this->offsets[i];j<this->offsets[i+1];++j){
+                if(i<=this->targets[j]) result.push_back(std::pair<uint32_t, uint32_t>(i, this->targets[j]));
+            }
+        }
+        return result;
+    }
+};
+
+template<typename N>
+class CSRGraphWeightedAndDirected : public CSRWeightedGraphBase<N>{
+public:
+    template<typename G>
+    explicit CSRGraphWeightedAndDirected(const G &g){
+        this->is_directed=true;
+        this->is_weighted=true;
+        this->max=g.getMax();
+        this->fillTargetsAndWeights(g.getSize(), g.getListOfEdges(), !g.isDirected());
+        if(!g.isDirected()) this->number_of_edges=this->offsets[this->size];
+    }
+
+    //builds the graph straight from an edge list, deduplicate keeps only the last occurrence of every edge
+    CSRGraphWeightedAndDirected(const uint32_t size, std::vector<std::pair<std::pair<uint32_t, uint32_t>, N>> edges, const N &max, const bool deduplicate=false){
+        this->is_directed=true;
+        this->is_weighted=true;
+        this->max=max;
+        this->checkEdges(size, edges);
+        if(deduplicate) prepareEdges(edges, false, true);
+        this->fillTargetsAndWeights(size, edges, false);
+    }
+
+    //takes over arrays that are already in the CSR form, every row has to be sorted
+    CSRGraphWeightedAndDirected(std::vector<uint64_t> &&offsets, std::vector<uint32_t> &&targets, std::vector<N> &&weights, const N &max){
+        this->is_directed=true;
+        this->is_weighted=true;
+        this->adoptStorage(offsets, targets, weights, max);
+    }
+
+    //uses external arrays without copying them
+    CSRGraphWeightedAndDirected(const CSRView &view, const N &max){
+        this->is_directed=true;
+        this->is_weighted=true;
+        this->attachView(view, max);
+    }
+
+    ~CSRGraphWeightedAndDirected()=default;
+
+    void transpose(){
+        this->transposeTargetsAndWeights();
+    }
+};
+
+template<typename N>
+class CSRGraphWeighted : public CSRWeightedGraphBase<N>{
+public:
+    //arcs u -> v and v -> u (and parallel arcs) of a directed g become a single edge with the smallest of their weights
+    template<typename G>
+    explicit CSRGraphWeighted(const G &g){
+        this->is_directed=false;
+        this->is_weighted=true;
+        this->max=g.getMax();
+        auto edges=g.getListOfEdges();
+        if(g.isDirected()){
+            prepareEdges(edges, true, false);
+            minimumEdges(edges);
+        }
+        this->fillTargetsAndWeights(g.getSize(), edges, true);
+    }
+
+    //builds the graph straight from an edge list, deduplicate keeps only the last occurrence of every edge
+    CSRGraphWeighted(const uint32_t size, std::vector<std::pair<std::pair<uint32_t, uint32_t>, N>> edges, const N &max, const bool deduplicate=false){
+        this->is_directed=false;
+        this->is_weighted=true;
+        this->max=max;
+        this->checkEdges(size, edges);
+        if(deduplicate) prepareEdges(edges, true, true);
+        this->fillTargetsAndWeights(size, edges, true);
+    }
+
+    //takes over arrays that are already in the CSR form, every row has to be sorted and every edge has to be in the rows of both endpoints
+    CSRGraphWeighted(std::vector<uint64_t> &&offsets, std::vector<uint32_t> &&targets, std::vector<N> &&weights, const N &max){
+        this->is_directed=false;
+        this->is_weighted=true;
+        this->adoptStorage(offsets, targets, weights, max);
+    }
+
+    //uses external arrays without copying them
+    CSRGraphWeighted(const CSRView &view, const N &max){
+        this->is_directed=false;
+        this->is_weighted=true;
+        this->attachView(view, max);
+    }
+
+    ~CSRGraphWeighted()=default;
+};
+
+#endif
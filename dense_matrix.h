@@ -0,0 +1,137 @@
+#ifndef DENSE_MATRIX_H
+#define DENSE_MATRIX_H
+
+#include <cstdint>
+#include <new>
+#include <memory>
+#include <algorithm>
+
+#define DENSE_MATRIX_ALIGNMENT 64
+
+//square matrix kept in one buffer, every row is padded to a whole number of cache lines
+template<typename N>
+class DenseMatrix{
+private:
+    N *data;
+    uint32_t size;
+    uint32_t capacity;
+    uint32_t stride;
+    N fill;
+
+    static uint32_t strideFor(const uint32_t capacity){
+        const uint32_t per_line=sizeof(N)<DENSE_MATRIX_ALIGNMENT ? DENSE_MATRIX_ALIGNMENT/sizeof(N) : 1;
+        return (capacity+per_line-1)/per_line*per_line;
+    }
+
+    static N *allocate(const uint64_t elements, const N &fill){
+        if(elements==0) return nullptr;
+        N *result=(N*)::operator new[](elements*sizeof(N), std::align_val_t(DENSE_MATRIX_ALIGNMENT));
+        std::uninitialized_fill_n(result, elements, fill);
+        return result;
+    }
+
+    static void release(N *ptr, const uint64_t elements){
+        if(!ptr) return;
+        std::destroy_n(ptr, elements);
+        ::operator delete[](ptr, std::align_val_t(DENSE_MATRIX_ALIGNMENT));
+    }
+
+    void reallocate(const uint32_t new_capacity){
+        const uint32_t new_stride=strideFor(new_capacity);
+        N *new_data=allocate((uint64_t)new_capacity*new_stride, this->fill);
+        for(uint32_t i=0;i<this->size;++i){
+            std::copy_n(this->getRow(i), this->size, new_data+(uint64_t)i*new_stride);
+        }
+        release(this->data, (uint64_t)this->capacity*this->stride);
+        this->data=new_data;
+        this->capacity=new_capacity;
+        this->stride=new_stride;
+    }
+
+public:
+    DenseMatrix(const uint32_t size, const N &fill){
+        this->size=size;
+        this->capacity=size;
+        this->stride=strideFor(size);
+        this->fill=fill;
+        this->data=allocate((uint64_t)size*this->stride, fill);
+    }
+
+    //reserves room for capacity rows and columns, every row has at least capacity columns (they are filled with fill)
+    DenseMatrix(const uint32_t size, const N &fill, const uint32_t capacity){
+        this->size=size;
+        this->capacity=std::max(size, capacity);
+        this->stride=strideFor(this->capacity);
+        this->fill=fill;
+        this->data=allocate((uint64_t)this->capacity*this->stride, fill);
+    }
+
+    DenseMatrix(const DenseMatrix &other){
+        this->size=other.size;
+        this->capacity=other.capacity;
+        this->stride=other.stride;
+        this->fill=other.fill;
+        this->data=allocate((uint64_t)other.capacity*other.stride, other.fill);
+        if(this->data) std::copy_n(other.data, (uint64_t)other.size*other.stride, this->data);
+    }
+
+    DenseMatrix& operator=(const DenseMatrix &other){
+        if(this==&other) return *this;
+        DenseMatrix tmp(other);
+        std::swap(this->data, tmp.data);
+        std::swap(this->size, tmp.size);
+        std::swap(this->capacity, tmp.capacity);
+        std::swap(this->stride, tmp.stride);
+        std::swap(this->fill, tmp.fill);
+        return *this;
+    }
+
+    ~DenseMatrix(){
+        release(this->data, (uint64_t)this->capacity*this->stride);
+    }
+
+    uint32_t getSize() const{
+        return this->size;
+    }
+
+    //distance (in elements) between the beginnings of two consecutive rows
+    uint32_t getStride() const{
+        return this->stride;
+    }
+
+    const N *getRow(const uint32_t row) const{
+        return this->data+(uint64_t)row*this->stride;
+    }
+
+    N *getRow(const uint32_t row){
+        return this->data+(uint64_t)row*this->stride;
+    }
+
+    const N& at(const uint32_t row, const uint32_t column) const{
+        return this->data[(uint64_t)row*this->stride+column];
+    }
+
+    N& at(const uint32_t row, const uint32_t column){
+        return this->data[(uint64_t)row*this->stride+column];
+    }
+
+    //adds a row and a column filled with the value given in the constructor, the capacity grows geometrically
+    uint32_t addRowAndColumn(){
+        if(this->size==this->capacity){
+            this->reallocate(std::max<uint32_t>(2*this->capacity, 16));
+        }
+        for(uint32_t i=0;i<this->size;++i) this->at(i, this->size)=this->fill;
+        std::fill_n(this->getRow(this->size), this->stride, this->fill);
+        return this->size++;
+    }
+
+    void transpose(){
+        for(uint32_t i=0;i<this->size;++i){
+            for(uint32_t j=i+1;j<this->size;++j){
+                std::swap(this->at(i, j), this->at(j, i));
+            }
+        }
+    }
+};
+
+#endif
@@ -0,0 +1,242 @@
+#ifndef EDGE_LIST_H
+#define EDGE_LIST_H
+
+#include <cstdint>
+#include <vector>
+#include <algorithm>
+
+#define EDGE_LIST_RADIX_BITS 16
+#define EDGE_LIST_RADIX_THRESHOLD 65536
+
+inline std::pair<uint32_t, uint32_t>& edgeEndpoints(std::pair<uint32_t, uint32_t> &edge){
+    return edge;
+}
+
+inline const std::pair<uint32_t, uint32_t>& edgeEndpoints(const std::pair<uint32_t, uint32_t> &edge){
+    return edge;
+}
+
+template<typename W>
+std::pair<uint32_t, uint32_t>& edgeEndpoints(std::pair<std::pair<uint32_t, uint32_t>, W> &edge){
+    return edge.first;
+}
+
+template<typename W>
+const std::pair<uint32_t, uint32_t>& edgeEndpoints(const std::pair<std::pair<uint32_t, uint32_t>, W> &edge){
+    return edge.first;
+}
+
+template<typename E>
+uint64_t edgeKey(const E &edge){
+    const std::pair<uint32_t, uint32_t> &p=edgeEndpoints(edge);
+    return ((uint64_t)p.first<<32)|p.second;
+}
+
+//stable LSD radix sort by (first, second), passes in which all keys share the same digit are skipped
+//smaller lists use std::stable_sort, clearing the counters (2 MB) would cost more than sorting them
+template<typename E>
+void sortEdges(std::vector<E> &edges){
+    if(edges.size()<EDGE_LIST_RADIX_THRESHOLD){
+        std::stable_sort(edges.begin(), edges.end(), [](const E &a, const E &b){
+            return edgeKey(a)<edgeKey(b);
+        });
+        return;
+    }
+    const uint32_t buckets=1<<EDGE_LIST_RADIX_BITS;
+    const uint32_t passes=64/EDGE_LIST_RADIX_BITS;
+    std::vector<uint64_t>count((uint64_t)passes*buckets, 0);
+    for(auto &e : edges){
+        const uint64_t key=edgeKey(e);
+        for(uint32_t p=0;p<passes;++p) ++count[(uint64_t)p*buckets+((key>>(p*EDGE_LIST_RADIX_BITS))&(buckets-1))];
+    }
+    std::vector<E>tmp(edges.size());
+    for(uint32_t p=0;p<passes;++p){
+        uint64_t *c=count.data()+(uint64_t)p*buckets;
+        const uint32_t shift=p*EDGE_LIST_RADIX_BITS;
+        if(c[(edgeKey(edges[0])>>shift)&(buckets-1)]==edges.size()) continue;
+        uint64_t sum=0;
+        for(uint32_t b=0;b<buckets;++b){
+            const uint64_t tmp_count=c[b];
+            c[b]=sum;
+            sum+=tmp_count;
+        }
+        for(auto &e : edges) tmp[c[(edgeKey(e)>>shift)&(buckets-1)]++]=e;
+        edges.swap(tmp);
+    }
+}
+
+//edges have to be sorted, of every group of equal edges only the last one is kept (for weighted edges the last weight wins)
+template<typename E>
+void uniqueEdges(std::vector<E> &edges){
+    uint64_t out=0;
+    for(uint64_t i=0;i<edges.size();++i){
+        if(i+1<edges.size() && edgeKey(edges[i])==edgeKey(edges[i+1])) continue;
+        edges[out++]=edges[i];
+    }
+    edges.resize(out);
+}
+
+//edges have to be sorted, of every group of equal edges only the one with the smallest weight is kept
+template<typename W>
+void minimumEdges(std::vector<std::pair<std::pair<uint32_t, uint32_t>, W>> &edges){
+    uint64_t out=0;
+    for(uint64_t i=0;i<edges.size();++i){
+        if(out && edges[out-1].first==edges[i].first){
+            if(edges[i].second<edges[out-1].second) edges[out-1].second=edges[i].second;
+            continue;
+        }
+        edges[out++]=edges[i];
+    }
+    edges.resize(out);
+}
+
+//symmetric puts the smaller endpoint first, so (u, v) and (v, u) are treated as the same edge
+template<typename E>
+void prepareEdges(std::vector<E> &edges, const bool symmetric, const bool deduplicate){
+    if(symmetric){
+        for(auto &e : edges){
+            std::pair<uint32_t, uint32_t> &p=edgeEndpoints(e);
+            if(p.first>p.second) std::swap(p.first, p.second);
+        }
+    }
+    sortEdges(edges);
+    if(deduplicate) uniqueEdges(edges);
+}
+
+//true if prepareEdges(edges, symmetric, deduplicate) would not change edges
+template<typename E>
+bool areEdgesPrepared(const std::vector<E> &edges, const bool symmetric, const bool deduplicate){
+    for(uint64_t i=0;i<edges.size();++i){
+        const std::pair<uint32_t, uint32_t> &p=edgeEndpoints(edges[i]);
+        if(symmetric && p.first>p.second) return false;
+        if(i==0) continue;
+        const uint64_t key=edgeKey(edges[i]), previous=edgeKey(edges[i-1]);
+        if(key<previous || (deduplicate && key==previous)) return false;
+    }
+    return true;
+}
+
+template<typename E>
+bool areEdgesInBounds(const std::vector<E> &edges, const uint32_t size){
+    for(auto &e : edges){
+        const std::pair<uint32_t, uint32_t> &p=edgeEndpoints(e);
+        if(p.first>=size || p.second>=size) return false;
+    }
+    return true;
+}
+
+//reserves room for the new entries of every list that gets one and returns these lists in increasing order, a list that has
+//to grow gets at least twice its capacity, so many small batches do not copy a long list every time
+//the work does not depend on the number of vertexes unless the batch is large (at least a quarter of them), then counting is cheaper than sorting
+template<typename E>
+std::vector<uint32_t> reserveForEdges(std::vector<std::vector<uint32_t>> &adjacency, const std::vector<E> &edges, const bool symmetric){
+    std::vector<uint32_t>rows;
+    auto reserve=[&adjacency](const uint32_t row, const uint64_t extra){
+        std::vector<uint32_t> &list=adjacency[row];
+        const uint64_t needed=list.size()+extra;
+        if(needed>list.capacity()) list.reserve(std::max<uint64_t>(needed, 2*list.capacity()));
+    };
+    if(symmetric && 4*edges.size()>=adjacency.size()){
+        std::vector<uint32_t>extra(adjacency.size(), 0);
+        for(auto &e : edges){
+            const std::pair<uint32_t, uint32_t> &p=edgeEndpoints(e);
+            ++extra[p.first];
+            if(p.first!=p.second) ++extra[p.second];
+        }
+        for(uint32_t i=0;i<adjacency.size();++i){
+            if(!extra[i]) continue;
+            reserve(i, extra[i]);
+            rows.push_back(i);
+        }
+        return rows;
+    }
+    rows.reserve(symmetric ? 2*edges.size() : edges.size());
+    for(auto &e : edges){
+        const std::pair<uint32_t, uint32_t> &p=edgeEndpoints(e);
+        rows.push_back(p.first);
+        if(symmetric && p.first!=p.second) rows.push_back(p.second);
+    }
+    //the first endpoints are already sorted by prepareEdges
+    if(symmetric) std::sort(rows.begin(), rows.end());
+    uint64_t out=0;
+    for(uint64_t i=0;i<rows.size();){
+        uint64_t j=i+1;
+        while(j<rows.size() && rows[j]==rows[i]) ++j;
+        reserve(rows[i], j-i);
+        rows[out++]=rows[i];
+        i=j;
+    }
+    rows.resize(out);
+    return rows;
+}
+
+//edges[begin, end) have the same first endpoint and are sorted and unique, positions[i-begin] becomes the first position
+//of the second endpoint of edges[i] in list (UINT32_MAX if it is not there), every entry of list costs one binary search
+template<typename E>
+void findEdgesInList(const std::vector<uint32_t> &list, const std::vector<E> &edges, const uint64_t begin, const uint64_t end, std::vector<uint32_t> &positions){
+    positions.assign(end-begin, UINT32_MAX);
+    for(uint32_t j=list.size();j-->0;){
+        const auto it=std::lower_bound(edges.begin()+begin, edges.begin()+end, list[j], [](const E &e, const uint32_t v){
+            return edgeEndpoints(e).second<v;
+        });
+        if(it!=edges.begin()+end && edgeEndpoints(*it).second==list[j]) positions[it-edges.begin()-begin]=j;
+    }
+}
+
+//edges have to be prepared by prepareEdges (with deduplication if skipExisting is set), skipExisting rejects edges that are already in the graph
+//the cost is O(E) plus, with skipExisting, O(deg log k) for every first endpoint with k new edges
+inline void insertEdges(std::vector<std::vector<uint32_t>> &adjacency, const std::vector<std::pair<uint32_t, uint32_t>> &edges, const bool symmetric, const bool skipExisting){
+    reserveForEdges(adjacency, edges, symmetric);
+    std::vector<uint32_t>positions;
+    for(uint64_t begin=0, end;begin<edges.size();begin=end){
+        const uint32_t u=edges[begin].first;
+        for(end=begin+1;end<edges.size() && edges[end].first==u;++end);
+        if(skipExisting) findEdgesInList(adjacency[u], edges, begin, end, positions);
+        for(uint64_t i=begin;i<end;++i){
+            if(skipExisting && positions[i-begin]!=UINT32_MAX) continue;
+            const uint32_t v=edges[i].second;
+            adjacency[u].push_back(v);
+            if(symmetric && u!=v) adjacency[v].push_back(u);
+        }
+    }
+}
+
+//same as above, an edge that is already in the graph gets the new weight
+//(for symmetric lists the copies v -> u are updated afterwards, grouped by v)
+template<typename N>
+void insertEdges(std::vector<std::vector<uint32_t>> &targets, std::vector<std::vector<N>> &weights, const std::vector<std::pair<std::pair<uint32_t, uint32_t>, N>> &edges, const bool symmetric, const bool skipExisting){
+    for(uint32_t i : reserveForEdges(targets, edges, symmetric)) weights[i].reserve(targets[i].capacity());
+    std::vector<uint32_t>positions;
+    std::vector<std::pair<std::pair<uint32_t, uint32_t>, N>>reverse_updates;
+    for(uint64_t begin=0, end;begin<edges.size();begin=end){
+        const uint32_t u=edges[begin].first.first;
+        for(end=begin+1;end<edges.size() && edges[end].first.first==u;++end);
+        if(skipExisting) findEdgesInList(targets[u], edges, begin, end, positions);
+        for(uint64_t i=begin;i<end;++i){
+            const uint32_t v=edges[i].first.second;
+            const N &w=edges[i].second;
+            if(skipExisting && positions[i-begin]!=UINT32_MAX){
+                weights[u][positions[i-begin]]=w;
+                if(symmetric && u!=v) reverse_updates.push_back(std::pair<std::pair<uint32_t, uint32_t>, N>(std::pair<uint32_t, uint32_t>(v, u), w));
+                continue;
+            }
+            targets[u].push_back(v);
+            weights[u].push_back(w);
+            if(symmetric && u!=v){
+                targets[v].push_back(u);
+                weights[v].push_back(w);
+            }
+        }
+    }
+    sortEdges(reverse_updates);
+    for(uint64_t begin=0, end;begin<reverse_updates.size();begin=end){
+        const uint32_t v=reverse_updates[begin].first.first;
+        for(end=begin+1;end<reverse_updates.size() && reverse_updates[end].first.first==v;++end);
+        findEdgesInList(targets[v], reverse_updates, begin, end, positions);
+        for(uint64_t i=begin;i<end;++i){
+            if(positions[i-begin]!=UINT32_MAX) weights[v][positions[i-begin]]=reverse_updates[i].second;
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,28 @@
+#include <iostream>
+#include "../graph_library.h"
+
+int main(){
+    double inf=1/0.;
+    ListGraphWeightedAndDirected<double>graph(6, inf); //creating a graph that will be used to build a CSR graph.
+
+    //adding some edges
+    graph.addEdge(0, 1, 7.);
+    graph.addEdge(0, 2, 9.);
+    graph.addEdge(1, 3, 15.);
+    graph.addEdge(2, 3, 11.);
+    graph.addEdge(3, 4, 6.);
+    graph.addEdge(4, 5, 9.);
+    graph.addEdge(2, 5, 14.);
+
+    //building a read-only CSR graph, from now on changes made to the list graph are not visible in csr.
+    CSRGraphWeightedAndDirected<double>csr(graph);
+
+    //iterating over neighbours doesn't copy anything.
+    for(auto it : csr.getNeighboursWithWeights(0)){
+        std::cout<<it.first<<' '<<it.second<<'\n';
+    }
+
+    //CSR graph can be used by every algorithm from the library.
+    std::cout<<dijkstra<CSRGraphWeightedAndDirected<double>, double, Priority_Q<BinaryHeap<double>, double>>(csr, 0, 5)<<'\n';
+    return 0;
+}
@@ -0,0 +1,30 @@
+#include <iostream>
+#include "../graph_library.h"
+
+int main(){
+    ListGraphWeightedAndDirected<int>graph(5, INT32_MAX); //creating an instance of a graph.
+
+    //adding some edges
+    graph.addEdge(0, 1, 4);
+    graph.addEdge(1, 2, 6);
+    graph.addEdge(2, 3, 3);
+    graph.addEdge(0, 2, 12);
+    graph.addEdge(3, 4, 1);
+
+    //one workspace (with its priority queue) is reused by every query, nothing is allocated after this line.
+    SearchWorkspace<int, Priority_Q<RadixHeap<int>, int>>ws(graph.getSize());
+
+    //the same queries twice, a radix heap emptied by the previous search accepts small values again.
+    for(int i=0;i<2;++i){
+        std::cout<<dijkstra(graph, 0, 3, ws)<<'\n';
+        std::cout<<dijkstra(graph, 1, 4, ws)<<'\n';
+    }
+
+    //the workspace keeps the results of the last query.
+    std::vector<uint32_t>path;
+    if(dijkstra_path(graph, 0, 4, ws, path)){
+        for(uint32_t v : path) std::cout<<v<<' ';
+        std::cout<<'\n';
+    }
+    return 0;
+}
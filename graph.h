@@ -4,7 +4,11 @@
 #include <cstdint>
 #include <vector>
 #include <cstdio>
-#include <fstream>
+#include "neighbour_range.h"
+#include "bit_matrix.h"
+#include "dense_matrix.h"
+#include "edge_list.h"
+#include "adjacency_lists.h"
 #include "error_info.h"
 
 class Graph{
@@ -55,30 +59,46 @@ public:
 
 class ListGraphDirected : public GraphUnweighted{
 private:
-    std::vector<std::vector<uint32_t>> adjacencyList;
+    AdjacencyLists<NoWeight> adjacencyList;
+    AdjacencyLists<NoWeight> reverseList;
+    bool keep_in_edges;
+
+    //edges have to be prepared by prepareEdges, with keepInEdges they are then reversed and sorted again for the in-neighbour lists
+    void insertPreparedEdges(std::vector<std::pair<uint32_t, uint32_t>> &edges, const bool saveFlag){
+        adjacencyList.insertEdges(edges, false, saveFlag);
+        if(!keep_in_edges) return;
+        for(auto &e : edges){
+            std::pair<uint32_t, uint32_t> &p=edgeEndpoints(e);
+            std::swap(p.first, p.second);
+        }
+        prepareEdges(edges, false, false);
+        reverseList.insertEdges(edges, false, saveFlag);
+    }
 public:
-    ListGraphDirected(const uint32_t size){
-        for(uint32_t i=0;i<size;++i) adjacencyList.push_back(std::vector<uint32_t>());
+    //keepInEdges maintains the in-neighbours of every vertex, transpose() then takes O(1)
+    ListGraphDirected(const uint32_t size, const AdjacencyIndex index=ADJACENCY_UNORDERED, const bool keepInEdges=false) : adjacencyList(size, index), reverseList(keepInEdges ? size : 0, index){
         this->is_directed=true;
         this->is_weighted=false;
+        this->keep_in_edges=keepInEdges;
     }
 
     ~ListGraphDirected()=default;
 
+    AdjacencyIndex getAdjacencyIndex() const{
+        return adjacencyList.getIndex();
+    }
+
+    bool hasInEdges() const{
+        return keep_in_edges;
+    }
+
     void transpose(){
-        std::vector<std::vector<uint32_t>> tmp(this->getSize(), std::vector<uint32_t>());
-        for(uint32_t i=0;i<this->getSize();++i) {
-            for(auto j : adjacencyList[i]) {
-                tmp[j].push_back(i);
-            }
-        }
-        for(uint32_t i=0;i<this->getSize();++i) {
-            adjacencyList[i]=tmp[i];
-        }
+        if(keep_in_edges) std::swap(adjacencyList, reverseList);
+        else adjacencyList.transpose();
     }
 
     uint32_t getSize() const override{
-        return adjacencyList.size();
+        return adjacencyList.getSize();
     }
 
     bool areVertexesConnected(const uint32_t first, const uint32_t second) const override{
@@ -88,15 +108,12 @@ public:
         if(this->isIndexOutOfBounds(second)){
             printErrorMsg(2, "The second argument of a method areVertexesConnected(const uint32_t, const uint32_t) in a class ListGraphDirected is out of bounds.");
         }
-        for(uint32_t v : adjacencyList[first]){
-            if(v==second) return true;
-        }
-        return false;
+        return adjacencyList.contains(first, second);
     }
 
     uint32_t addVertex() override{
-        adjacencyList.push_back(std::vector<uint32_t>());
-        return adjacencyList.size()-1;
+        if(keep_in_edges) reverseList.addVertex();
+        return adjacencyList.addVertex();
     }
 
     void deleteEdge(const uint32_t first, const uint32_t second) override{
@@ -106,19 +123,38 @@ public:
         if(this->isIndexOutOfBounds(second)){
             printErrorMsg(2, "The second argument of a method deleteEdge(const uint32_t, const uint32_t) in a class ListGraphDirected is out of bounds.");
         }
-        for(int32_t i=0;i<adjacencyList[first].size();++i){
-            if(adjacencyList[first][i]==second){
-                adjacencyList[first].erase(adjacencyList[first].begin()+i);
-                --i;
-            }
-        }
+        if(adjacencyList.eraseAll(first, second) && keep_in_edges) reverseList.eraseAll(second, first);
     }
 
     const std::vector<uint32_t> getNeighbours(const uint32_t vertex) const override{
         if(this->isIndexOutOfBounds(vertex)){
             printErrorMsg(2, "The argument of a method getNeighbours(const uint32_t) in a class ListGraphDirected is out of bounds.");
         }
-        return adjacencyList[vertex];
+        return adjacencyList.getTargets(vertex);
+    }
+
+    const NeighbourRange getNeighboursRange(const uint32_t vertex) const{
+        if(this->isIndexOutOfBounds(vertex)){
+            printErrorMsg(2, "The argument of a method getNeighboursRange(const uint32_t) in a class ListGraphDirected is out of bounds.");
+        }
+        const std::vector<uint32_t> &t=adjacencyList.getTargets(vertex);
+        return NeighbourRange(t.data(), t.data()+t.size());
+    }
+
+    const std::vector<uint32_t> getInNeighbours(const uint32_t vertex) const{
+        const NeighbourRange r=this->getInNeighboursRange(vertex);
+        return std::vector<uint32_t>(r.begin(), r.end());
+    }
+
+    const NeighbourRange getInNeighboursRange(const uint32_t vertex) const{
+        if(!keep_in_edges){
+            printErrorMsg(2, "A method getInNeighboursRange(const uint32_t) was called on a ListGraphDirected created without keepInEdges.");
+        }
+        if(this->isIndexOutOfBounds(vertex)){
+            printErrorMsg(2, "The argument of a method getInNeighboursRange(const uint32_t) in a class ListGraphDirected is out of bounds.");
+        }
+        const std::vector<uint32_t> &t=reverseList.getTargets(vertex);
+        return NeighbourRange(t.data(), t.data()+t.size());
     }
 
     void addEdge(const uint32_t first, const uint32_t second) override{
@@ -133,23 +169,37 @@ public:
             printErrorMsg(2, "The second argument of a method addEdge(const uint32_t, const uint32_t) in a class ListGraphDirected is out of bounds.");
         }
 
-        bool flag=false;
-        if(saveFlag){
-            for(auto i : adjacencyList[first]){
-                if(second==i){
-                    flag=true;
-                    break;
-                }
-            }
+        if(saveFlag && adjacencyList.contains(first, second)) return;
+        adjacencyList.insert(first, second);
+        if(keep_in_edges) reverseList.insert(second, first);
+    }
+
+    //edges are sorted and inserted at once, saveFlag rejects duplicates (also the ones already in the graph) like in addEdge
+    //a moved list is sorted in place
+    void addEdges(std::vector<std::pair<uint32_t, uint32_t>> &&edges, const bool saveFlag=false){
+        if(!areEdgesInBounds(edges, this->getSize())){
+            printErrorMsg(2, "One of the edges passed to a method addEdges(std::vector<std::pair<uint32_t, uint32_t>>&&, const bool) in a class ListGraphDirected is out of bounds.");
         }
-        
-        if(!flag) adjacencyList[first].push_back(second);
+        prepareEdges(edges, false, saveFlag);
+        this->insertPreparedEdges(edges, saveFlag);
+    }
+
+    //the list is copied only if it is not sorted already (or has duplicates when saveFlag is set) or if in-edges are kept
+    void addEdges(const std::vector<std::pair<uint32_t, uint32_t>> &edges, const bool saveFlag=false){
+        if(keep_in_edges || !areEdgesPrepared(edges, false, saveFlag)){
+            this->addEdges(std::vector<std::pair<uint32_t, uint32_t>>(edges), saveFlag);
+            return;
+        }
+        if(!areEdgesInBounds(edges, this->getSize())){
+            printErrorMsg(2, "One of the edges passed to a method addEdges(const std::vector<std::pair<uint32_t, uint32_t>>&, const bool) in a class ListGraphDirected is out of bounds.");
+        }
+        adjacencyList.insertEdges(edges, false, saveFlag);
     }
 
     const std::vector<std::pair<uint32_t, uint32_t>> getListOfEdges() const override {
         std::vector<std::pair<uint32_t, uint32_t>>result;
         for(uint32_t i=0;i<getSize();++i) {
-            for(auto j : adjacencyList[i]) {
+            for(uint32_t j : adjacencyList.getTargets(i)) {
                 result.push_back(std::pair<uint32_t, uint32_t>(i,j));
             }
         }
@@ -160,33 +210,47 @@ public:
 template <typename N>
 class ListGraphWeightedAndDirected : public WeightedGraph<N>{
 private:
-    std::vector<std::vector<std::pair<uint32_t,N>>> adjacencyList;
-public:
-    ListGraphWeightedAndDirected(const uint32_t size, const N &max){
-        for(uint32_t i=0;i<size;++i){
-            adjacencyList.push_back(std::vector<std::pair<uint32_t, N>>());
+    AdjacencyLists<N> adjacencyList;
+    AdjacencyLists<N> reverseList;
+    bool keep_in_edges;
+
+    //edges have to be prepared by prepareEdges, with keepInEdges they are then reversed and sorted again for the in-neighbour lists
+    void insertPreparedEdges(std::vector<std::pair<std::pair<uint32_t, uint32_t>, N>> &edges, const bool saveFlag){
+        adjacencyList.insertEdges(edges, false, saveFlag);
+        if(!keep_in_edges) return;
+        for(auto &e : edges){
+            std::pair<uint32_t, uint32_t> &p=edgeEndpoints(e);
+            std::swap(p.first, p.second);
         }
+        prepareEdges(edges, false, false);
+        reverseList.insertEdges(edges, false, saveFlag);
+    }
+public:
+    //keepInEdges maintains the in-neighbours of every vertex, transpose() then takes O(1)
+    ListGraphWeightedAndDirected(const uint32_t size, const N &max, const AdjacencyIndex index=ADJACENCY_UNORDERED, const bool keepInEdges=false) : adjacencyList(size, index), reverseList(keepInEdges ? size : 0, index){
         this->is_directed=true;
         this->is_weighted=true;
         this->max=max;
+        this->keep_in_edges=keepInEdges;
     }
 
     ~ListGraphWeightedAndDirected()=default;
 
+    AdjacencyIndex getAdjacencyIndex() const{
+        return adjacencyList.getIndex();
+    }
+
+    bool hasInEdges() const{
+        return keep_in_edges;
+    }
+
     void transpose(){
-        std::vector<std::vector<std::pair<uint32_t, N>>> tmp(this->getSize(), std::vector<std::pair<uint32_t, N>>());
-        for(uint32_t i=0;i<this->getSize();++i) {
-            for(auto j : adjacencyList[i]) {
-                tmp[j.first].push_back(std::pair<uint32_t, N>(i,j.second));
-            }
-        }
-        for(uint32_t i=0;i<this->getSize();++i) {
-            adjacencyList[i]=tmp[i];
-        }
+        if(keep_in_edges) std::swap(adjacencyList, reverseList);
+        else adjacencyList.transpose();
     }
 
     uint32_t getSize() const override{
-        return adjacencyList.size();
+        return adjacencyList.getSize();
     }
 
     bool areVertexesConnected(const uint32_t first, const uint32_t second) const override{
@@ -196,15 +260,12 @@ public:
         if(this->isIndexOutOfBounds(second)){
             printErrorMsg(2, "The second argument of a method areVertexesConnected(const uint32_t, const uint32_t) in a class ListGraphWeightedAndDirected<N> is out of bounds.");
         }
-        for(auto i : adjacencyList[first]){
-            if(i.first==second) return true;
-        }
-        return false;
+        return adjacencyList.contains(first, second);
     }
 
     uint32_t addVertex() override{
-        adjacencyList.push_back(std::vector<std::pair<uint32_t, N>>());
-        return adjacencyList.size()-1;
+        if(keep_in_edges) reverseList.addVertex();
+        return adjacencyList.addVertex();
     }
 
     void deleteEdge(const uint32_t first, const uint32_t second) override{
@@ -214,12 +275,7 @@ public:
         if(this->isIndexOutOfBounds(second)){
             printErrorMsg(2, "The second argument of a method deleteEdge(const uint32_t, const uint32_t) in a class ListGraphWeightedAndDirected<N> is out of bounds.");
         }
-        for(int32_t i=0;i<adjacencyList[first].size();++i){
-            if(adjacencyList[first][i].first==second){
-                adjacencyList[first].erase(adjacencyList[first].begin()+i);
-                --i;
-            }
-        }
+        if(adjacencyList.eraseAll(first, second) && keep_in_edges) reverseList.eraseAll(second, first);
     }
 
     bool deleteEdge(const uint32_t first, const uint32_t second, const N &weight){
@@ -229,36 +285,73 @@ public:
         if(this->isIndexOutOfBounds(second)){
             printErrorMsg(2, "The second argument of a method deleteEdge(const uint32_t, const uint32_t) in a class ListGraphWeightedAndDirected<N> is out of bounds.");
         }
+        if(!adjacencyList.eraseOne(first, second, weight)) return false;
+        if(keep_in_edges) reverseList.eraseOne(second, first, weight);
+        return true;
+    }
 
-        bool result=false;
-
-        for(int32_t i=0;i<adjacencyList[first].size();++i){
-            if(adjacencyList[first][i].first==second && adjacencyList[first][i].second==weight){
-                adjacencyList[first].erase(adjacencyList[first].begin()+i);
-                result=true;
-                break;
-            }
+    const std::vector<uint32_t> getNeighbours(const uint32_t vertex) const override{
+        if(this->isIndexOutOfBounds(vertex)){
+            printErrorMsg(2, "The argument of a method getNeighbours(const uint32_t) in a class ListGraphWeightedAndDirected<N> is out of bounds.");
         }
+        return adjacencyList.getTargets(vertex);
+    }
 
+    const std::vector<std::pair<uint32_t,N>> getNeighboursWithWeights(const uint32_t vertex) const override {
+        if(this->isIndexOutOfBounds(vertex)){
+            printErrorMsg(2, "The argument of a method getNeighboursWithWeights(const uint32_t) in a class ListGraphWeightedAndDirected<N> is out of bounds.");
+        }
+        std::vector<std::pair<uint32_t,N>>result;
+        result.reserve(adjacencyList.getDegree(vertex));
+        for(const auto &i : this->getNeighboursWithWeightsRange(vertex)) result.push_back(i);
         return result;
     }
 
-    const std::vector<uint32_t> getNeighbours(const uint32_t vertex) const override{
+    const NeighbourRange getNeighboursRange(const uint32_t vertex) const{
         if(this->isIndexOutOfBounds(vertex)){
-            printErrorMsg(2, "The argument of a method getNeighbours(const uint32_t) in a class ListGraphWeightedAndDirected<N> is out of bounds.");
+            printErrorMsg(2, "The argument of a method getNeighboursRange(const uint32_t) in a class ListGraphWeightedAndDirected<N> is out of bounds.");
         }
-        std::vector<uint32_t>result;
-        for(auto v : adjacencyList[vertex]) {
-            result.push_back(v.first);
+        const std::vector<uint32_t> &t=adjacencyList.getTargets(vertex);
+        return NeighbourRange(t.data(), t.data()+t.size());
+    }
+
+    const WeightedNeighbourRange<N> getNeighboursWithWeightsRange(const uint32_t vertex) const{
+        if(this->isIndexOutOfBounds(vertex)){
+            printErrorMsg(2, "The argument of a method getNeighboursWithWeightsRange(const uint32_t) in a class ListGraphWeightedAndDirected<N> is out of bounds.");
         }
+        return WeightedNeighbourRange<N>(adjacencyList.getTargets(vertex).data(), adjacencyList.getWeights(vertex).data(), adjacencyList.getDegree(vertex));
+    }
+
+    const std::vector<uint32_t> getInNeighbours(const uint32_t vertex) const{
+        const NeighbourRange r=this->getInNeighboursRange(vertex);
+        return std::vector<uint32_t>(r.begin(), r.end());
+    }
+
+    const std::vector<std::pair<uint32_t,N>> getInNeighboursWithWeights(const uint32_t vertex) const{
+        std::vector<std::pair<uint32_t,N>>result;
+        for(const auto &i : this->getInNeighboursWithWeightsRange(vertex)) result.push_back(i);
         return result;
     }
 
-    const std::vector<std::pair<uint32_t,N>> getNeighboursWithWeights(const uint32_t vertex) const override {
+    const NeighbourRange getInNeighboursRange(const uint32_t vertex) const{
+        if(!keep_in_edges){
+            printErrorMsg(2, "A method getInNeighboursRange(const uint32_t) was called on a ListGraphWeightedAndDirected<N> created without keepInEdges.");
+        }
         if(this->isIndexOutOfBounds(vertex)){
-            printErrorMsg(2, "The argument of a method getNeighboursWithWeights(const uint32_t) in a class ListGraphWeightedAndDirected<N> is out of bounds.");
+            printErrorMsg(2, "The argument of a method getInNeighboursRange(const uint32_t) in a class ListGraphWeightedAndDirected<N> is out of bounds.");
+        }
+        const std::vector<uint32_t> &t=reverseList.getTargets(vertex);
+        return NeighbourRange(t.data(), t.data()+t.size());
+    }
+
+    const WeightedNeighbourRange<N> getInNeighboursWithWeightsRange(const uint32_t vertex) const{
+        if(!keep_in_edges){
+            printErrorMsg(2, "A method getInNeighboursWithWeightsRange(const uint32_t) was called on a ListGraphWeightedAndDirected<N> created without keepInEdges.");
+        }
+        if(this->isIndexOutOfBounds(vertex)){
+            printErrorMsg(2, "The argument of a method getInNeighboursWithWeightsRange(const uint32_t) in a class ListGraphWeightedAndDirected<N> is out of bounds.");
         }
-        return adjacencyList[vertex];
+        return WeightedNeighbourRange<N>(reverseList.getTargets(vertex).data(), reverseList.getWeights(vertex).data(), reverseList.getDegree(vertex));
     }
 
     void addEdge(const uint32_t v1, const uint32_t v2, const N &weight) override{
@@ -272,17 +365,35 @@ public:
         if(this->isIndexOutOfBounds(v2)){
             printErrorMsg(2, "The second argument of a method addEdge(const uint32_t, const uint32_t, const N) in a class ListGraphWeightedAndDirected<N> is out of bounds.");
         }
-        bool flag=false;
-        if(saveFlag){
-            for(auto i : adjacencyList[v1]){
-                if(i.first==v2){
-                    i.second=weight;
-                    flag=true;
-                    break;
-                }
-            }
+        N previous;
+        if(saveFlag && adjacencyList.updateWeight(v1, v2, weight, &previous)){
+            if(keep_in_edges) reverseList.replaceWeight(v2, v1, previous, weight);
+            return;
+        }
+        adjacencyList.insert(v1, v2, weight);
+        if(keep_in_edges) reverseList.insert(v2, v1, weight);
+    }
+
+    //edges are sorted and inserted at once, saveFlag rejects duplicates (also the ones already in the graph) like in addEdge
+    //a moved list is sorted in place
+    void addEdges(std::vector<std::pair<std::pair<uint32_t, uint32_t>, N>> &&edges, const bool saveFlag=false){
+        if(!areEdgesInBounds(edges, this->getSize())){
+            printErrorMsg(2, "One of the edges passed to a method addEdges(std::vector<std::pair<std::pair<uint32_t, uint32_t>, N>>&&, const bool) in a class ListGraphWeightedAndDirected<N> is out of bounds.");
+        }
+        prepareEdges(edges, false, saveFlag);
+        this->insertPreparedEdges(edges, saveFlag);
+    }
+
+    //the list is copied only if it is not sorted already (or has duplicates when saveFlag is set) or if in-edges are kept
+    void addEdges(const std::vector<std::pair<std::pair<uint32_t, uint32_t>, N>> &edges, const bool saveFlag=false){
+        if(keep_in_edges || !areEdgesPrepared(edges, false, saveFlag)){
+            this->addEdges(std::vector<std::pair<std::pair<uint32_t, uint32_t>, N>>(edges), saveFlag);
+            return;
         }
-        if(!flag) adjacencyList[v1].push_back(std::pair<uint32_t,N>(v2,weight));
+        if(!areEdgesInBounds(edges, this->getSize())){
+            printErrorMsg(2, "One of the edges passed to a method addEdges(const std::vector<std::pair<std::pair<uint32_t, uint32_t>, N>>&, const bool) in a class ListGraphWeightedAndDirected<N> is out of bounds.");
+        }
+        adjacencyList.insertEdges(edges, false, saveFlag);
     }
 
     N getWeight(const uint32_t first, const uint32_t second) const override{
@@ -292,20 +403,13 @@ public:
         if(this->isIndexOutOfBounds(second)){
             printErrorMsg(2, "The second argument of a method getWeight(const uint32_t, const uint32_t) in a class ListGraphWeightedAndDirected<N> is out of bounds.");
         }
-
-        N result=this->max;
-        for(auto v : adjacencyList[first]) {
-            if(v.first==second && v.second<result){
-                result=v.second;
-            } 
-        }
-        return result;
+        return adjacencyList.minWeight(first, second, this->max);
     }
 
     const std::vector<std::pair<std::pair<uint32_t, uint32_t>, N>> getListOfEdges() const override {
         std::vector<std::pair<std::pair<uint32_t, uint32_t>, N>>result;
         for(uint32_t i=0;i<getSize();++i) {
-            for(auto j : adjacencyList[i]) {
+            for(const auto &j : this->getNeighboursWithWeightsRange(i)) {
                 result.push_back(std::pair<std::pair<uint32_t,uint32_t>,N>(std::pair<uint32_t, uint32_t>(i,j.first),j.second));
             }
         }
@@ -316,10 +420,14 @@ public:
 template <typename N>
 class ListGraphWeighted : public WeightedGraph<N>{
 private:
-    std::vector<std::vector<std::pair<uint32_t,N>>> adjacencyList;
+    AdjacencyLists<N> adjacencyList;
+
+    //edges have to be prepared by prepareEdges
+    void insertPreparedEdges(const std::vector<std::pair<std::pair<uint32_t, uint32_t>, N>> &edges, const bool saveFlag){
+        adjacencyList.insertEdges(edges, true, saveFlag);
+    }
 public:
-    ListGraphWeighted(const uint32_t size, const N &max){
-        for(uint32_t i=0;i<size;++i) adjacencyList.push_back(std::vector<std::pair<uint32_t,N>>());
+    ListGraphWeighted(const uint32_t size, const N &max, const AdjacencyIndex index=ADJACENCY_UNORDERED) : adjacencyList(size, index){
         this->is_directed=false;
         this->is_weighted=true;
         this->max=max;
@@ -327,9 +435,12 @@ public:
 
     ~ListGraphWeighted()=default;
 
+    AdjacencyIndex getAdjacencyIndex() const{
+        return adjacencyList.getIndex();
+    }
 
     uint32_t getSize() const override{
-        return adjacencyList.size();
+        return adjacencyList.getSize();
     }
 
     bool areVertexesConnected(uint32_t first, uint32_t second) const override{
@@ -339,16 +450,12 @@ public:
         if(this->isIndexOutOfBounds(second)){
             printErrorMsg(2, "The second argument of a method areVertexesConnected(const uint32_t, const uint32_t) in a class ListGraphWeighted<N> is out of bounds.");
         }
-        if(adjacencyList[first].size()>adjacencyList[second].size()) std::swap(first,second);
-        for(auto i : adjacencyList[first]) {
-            if(i.first==second) return true;
-        }
-        return false;
+        if(adjacencyList.getDegree(first)>adjacencyList.getDegree(second)) std::swap(first,second);
+        return adjacencyList.contains(first, second);
     }
 
     uint32_t addVertex() override{
-        adjacencyList.push_back(std::vector<std::pair<uint32_t, N>>());
-        return adjacencyList.size()-1;
+        return adjacencyList.addVertex();
     }
 
     void deleteEdge(uint32_t first, uint32_t second) override{
@@ -358,25 +465,7 @@ public:
         if(this->isIndexOutOfBounds(second)){
             printErrorMsg(2, "The second argument of a method deleteEdge(const uint32_t, const uint32_t) in a class ListGraphWeighted<N> is out of bounds.");
         }
-        if(adjacencyList[first].size()>adjacencyList[second].size()) std::swap(first, second);
-
-        bool flag=false;
-        for(int32_t i=0;i<adjacencyList[first].size();++i){
-            if(adjacencyList[first][i].first==second){
-                adjacencyList[first].erase(adjacencyList[first].begin()+i);
-                flag=true;
-                --i;
-            }
-        }
-
-        if(flag){
-            for(int32_t i=0;i<adjacencyList[second].size();++i) {
-                if(adjacencyList[second][i].first==first) {
-                    adjacencyList[second].erase(adjacencyList[second].begin()+i);
-                    --i;
-                }
-            }
-        }
+        if(adjacencyList.eraseAll(first, second) && first!=second) adjacencyList.eraseAll(second, first);
     }
 
     bool deleteEdge(uint32_t first, uint32_t second, const N &weight){
@@ -387,26 +476,8 @@ public:
             printErrorMsg(2, "The second argument of a method deleteEdge(const uint32_t, const uint32_t) in a class ListGraphWeighted<N> is out of bounds.");
         }
 
-        bool result=false;
-        if(adjacencyList[first].size()>adjacencyList[second].size()) std::swap(first, second);
-
-        for(int i=0;i<adjacencyList[first].size();++i){
-            if(adjacencyList[first][i].second==weight){
-                adjacencyList[first].erase(adjacencyList[first].begin()+i);
-                result=true;
-                break;
-            }
-        }
-        
-        if(result){
-            for(int i=0;i<adjacencyList[second].size();++i){
-                if(adjacencyList[second][i].second==weight){
-                    adjacencyList[second].erase(adjacencyList[second].begin()+i);
-                    break;
-                }
-            }
-        }
-
+        bool result=adjacencyList.eraseOne(first, second, weight);
+        if(result && first!=second) adjacencyList.eraseOne(second, first, weight);
         return result;
     }
 
@@ -414,18 +485,32 @@ public:
         if(this->isIndexOutOfBounds(vertex)){
             printErrorMsg(2, "The argument of a method getNeighbours(const uint32_t) in a class ListGraphWeighted<N> is out of bounds.");
         }
-        std::vector<uint32_t>result;
-        for(auto i : adjacencyList[vertex]) {
-            result.push_back(i.first);
-        }
-        return result;
+        return adjacencyList.getTargets(vertex);
     }
 
     const std::vector<std::pair<uint32_t,N>> getNeighboursWithWeights(const uint32_t vertex) const override {
         if(this->isIndexOutOfBounds(vertex)){
             printErrorMsg(2, "The argument of a method getNeighboursWithWeights(const uint32_t) in a class ListGraphWeighted<N> is out of bounds.");
         }
-        return adjacencyList[vertex];
+        std::vector<std::pair<uint32_t,N>>result;
+        result.reserve(adjacencyList.getDegree(vertex));
+        for(const auto &i : this->getNeighboursWithWeightsRange(vertex)) result.push_back(i);
+        return result;
+    }
+
+    const NeighbourRange getNeighboursRange(const uint32_t vertex) const{
+        if(this->isIndexOutOfBounds(vertex)){
+            printErrorMsg(2, "The argument of a method getNeighboursRange(const uint32_t) in a class ListGraphWeighted<N> is out of bounds.");
+        }
+        const std::vector<uint32_t> &t=adjacencyList.getTargets(vertex);
+        return NeighbourRange(t.data(), t.data()+t.size());
+    }
+
+    const WeightedNeighbourRange<N> getNeighboursWithWeightsRange(const uint32_t vertex) const{
+        if(this->isIndexOutOfBounds(vertex)){
+            printErrorMsg(2, "The argument of a method getNeighboursWithWeightsRange(const uint32_t) in a class ListGraphWeighted<N> is out of bounds.");
+        }
+        return WeightedNeighbourRange<N>(adjacencyList.getTargets(vertex).data(), adjacencyList.getWeights(vertex).data(), adjacencyList.getDegree(vertex));
     }
 
     void addEdge(uint32_t v1, uint32_t v2, const N &weight) override{
@@ -439,32 +524,35 @@ public:
         if(this->isIndexOutOfBounds(v2)){
             printErrorMsg(2, "The second argument of a method addEdge(uint32_t, uint32_t, const N) in a class ListGraphWeighted<N> is out of bounds.");
         }
-        bool flag=false;
-        if(saveFlag){
-            if(adjacencyList[v1].size()>adjacencyList[v2].size()) std::swap(v1,v2);
-            for(auto i : adjacencyList[v1]){
-                if(i.first==v2){
-                    i.second=weight;
-                    flag=true;
-                    break;
-                }
-            }
+        N previous;
+        if(saveFlag && adjacencyList.updateWeight(v1, v2, weight, &previous)){
+            if(v1!=v2) adjacencyList.replaceWeight(v2, v1, previous, weight);
+            return;
         }
-        
-        if(flag){
-            for(auto i : adjacencyList[v2]){
-                if(i.first==v1){
-                    i.second=weight;
-                    break;
-                }
-            }
+        adjacencyList.insert(v1, v2, weight);
+        if(v1!=v2) adjacencyList.insert(v2, v1, weight);
+    }
+
+    //edges are sorted and inserted at once, saveFlag rejects duplicates (also the ones already in the graph) like in addEdge
+    //a moved list is sorted in place
+    void addEdges(std::vector<std::pair<std::pair<uint32_t, uint32_t>, N>> &&edges, const bool saveFlag=false){
+        if(!areEdgesInBounds(edges, this->getSize())){
+            printErrorMsg(2, "One of the edges passed to a method addEdges(std::vector<std::pair<std::pair<uint32_t, uint32_t>, N>>&&, const bool) in a class ListGraphWeighted<N> is out of bounds.");
         }
-        else{
-            adjacencyList[v1].push_back(std::pair<uint32_t, N>(v2, weight));
-            if(v1!=v2){
-                adjacencyList[v2].push_back(std::pair<uint32_t, N>(v1, weight));
-            }
+        prepareEdges(edges, true, saveFlag);
+        this->insertPreparedEdges(edges, saveFlag);
+    }
+
+    //the list is copied only if it is not sorted already (or has duplicates when saveFlag is set)
+    void addEdges(const std::vector<std::pair<std::pair<uint32_t, uint32_t>, N>> &edges, const bool saveFlag=false){
+        if(!areEdgesPrepared(edges, true, saveFlag)){
+            this->addEdges(std::vector<std::pair<std::pair<uint32_t, uint32_t>, N>>(edges), saveFlag);
+            return;
         }
+        if(!areEdgesInBounds(edges, this->getSize())){
+            printErrorMsg(2, "One of the edges passed to a method addEdges(const std::vector<std::pair<std::pair<uint32_t, uint32_t>, N>>&, const bool) in a class ListGraphWeighted<N> is out of bounds.");
+        }
+        this->insertPreparedEdges(edges, saveFlag);
     }
 
     N getWeight(uint32_t first, uint32_t second) const override{
@@ -474,21 +562,14 @@ public:
         if(this->isIndexOutOfBounds(second)){
             printErrorMsg(2, "The second argument of a method addEdge(uint32_t, uint32_t, const N) in a class ListGraphWeighted<N> is out of bounds.");
         }
-        if(adjacencyList[first].size()>adjacencyList[second].size()) std::swap(first, second);
-        N weight=this->max;
-
-        for(auto i : adjacencyList[first]) {
-            if(i.first==second && i.second<weight){
-                weight=i.second;
-            } 
-        }
-        return weight;
+        if(adjacencyList.getDegree(first)>adjacencyList.getDegree(second)) std::swap(first, second);
+        return adjacencyList.minWeight(first, second, this->max);
     }
 
     const std::vector<std::pair<std::pair<uint32_t, uint32_t>, N>> getListOfEdges() const override {
         std::vector<std::pair<std::pair<uint32_t,uint32_t>,N>>result;
         for(uint32_t i=0;i<getSize();++i) {
-            for(auto j: adjacencyList[i]) {
+            for(const auto &j : this->getNeighboursWithWeightsRange(i)) {
                 if(i<=j.first) {
                     result.push_back(std::pair<std::pair<uint32_t,uint32_t>,N>(std::pair<uint32_t,uint32_t>(i,j.first),j.second));
                 }
@@ -500,18 +581,26 @@ public:
 
 class ListGraph : public GraphUnweighted{
 private:
-    std::vector<std::vector<uint32_t>> adjacencyList;
+    AdjacencyLists<NoWeight> adjacencyList;
+
+    //edges have to be prepared by prepareEdges
+    void insertPreparedEdges(const std::vector<std::pair<uint32_t, uint32_t>> &edges, const bool saveFlag){
+        adjacencyList.insertEdges(edges, true, saveFlag);
+    }
 public:
-    ListGraph(const uint32_t size){
-        for(uint32_t i=0;i<size;++i) adjacencyList.push_back(std::vector<uint32_t>());
+    ListGraph(const uint32_t size, const AdjacencyIndex index=ADJACENCY_UNORDERED) : adjacencyList(size, index){
         this->is_directed=false;
         this->is_weighted=false;
     }
 
     ~ListGraph()=default;
 
+    AdjacencyIndex getAdjacencyIndex() const{
+        return adjacencyList.getIndex();
+    }
+
     uint32_t getSize() const override{
-        return adjacencyList.size();
+        return adjacencyList.getSize();
     }
 
     bool areVertexesConnected(uint32_t first, uint32_t second) const override{
@@ -521,16 +610,12 @@ public:
         if(this->isIndexOutOfBounds(second)){
             printErrorMsg(2, "The second argument of a method areVertexesConnected(uint32_t, uint32_t) in a class ListGraph is out of bounds.");
         }
-        if(adjacencyList[first].size()>adjacencyList[second].size()) std::swap(first, second);
-        for(uint32_t i : adjacencyList[first]) {
-            if(i==second) return true;
-        }
-        return false;
+        if(adjacencyList.getDegree(first)>adjacencyList.getDegree(second)) std::swap(first, second);
+        return adjacencyList.contains(first, second);
     }
 
     uint32_t addVertex() override{
-        adjacencyList.push_back(std::vector<uint32_t>());
-        return adjacencyList.size()-1;
+        return adjacencyList.addVertex();
     }
 
     void deleteEdge(uint32_t first, uint32_t second) override{
@@ -540,29 +625,19 @@ public:
         if(this->isIndexOutOfBounds(second)){
             printErrorMsg(2, "The second argument of a method deleteEdge(uint32_t, uint32_t) in a class ListGraph is out of bounds.");
         }
-        if(adjacencyList[first].size()>adjacencyList[second].size()) std::swap(first, second);
-        bool flag=false;
-
-        for(int32_t i=0;i<adjacencyList[first].size();++i){
-            if(adjacencyList[first][i]==second){
-                adjacencyList[first].erase(adjacencyList[first].begin()+i);
-                flag=true;
-                --i;
-            }
-        }
-
-        if(flag){
-            for(int32_t i=0;i<adjacencyList[second].size();++i) {
-                if(adjacencyList[second][i]==first) {
-                    adjacencyList[second].erase(adjacencyList[second].begin()+i);
-                    --i;
-                }
-            }
-        }
+        if(adjacencyList.eraseAll(first, second) && first!=second) adjacencyList.eraseAll(second, first);
     }
 
     const std::vector<uint32_t> getNeighbours(const uint32_t vertex) const override{
-        return adjacencyList[vertex];
+        return adjacencyList.getTargets(vertex);
+    }
+
+    const NeighbourRange getNeighboursRange(const uint32_t vertex) const{
+        if(this->isIndexOutOfBounds(vertex)){
+            printErrorMsg(2, "The argument of a method getNeighboursRange(const uint32_t) in a class ListGraph is out of bounds.");
+        }
+        const std::vector<uint32_t> &t=adjacencyList.getTargets(vertex);
+        return NeighbourRange(t.data(), t.data()+t.size());
     }
 
     void addEdge(uint32_t first, uint32_t second) override{
@@ -576,29 +651,40 @@ public:
         if(this->isIndexOutOfBounds(second)){
             printErrorMsg(2, "The second argument of a method addEdge(uint32_t, uint32_t) in a class ListGraph is out of bounds.");
         }
-        bool flag=false;
         if(saveFlag){
-            if(adjacencyList[first].size()>adjacencyList[second].size()) std::swap(first,second);
-            for(auto i : adjacencyList[first]){
-                if(i==second){
-                    flag=true;
-                    break;
-                }
-            }
+            if(adjacencyList.getDegree(first)>adjacencyList.getDegree(second)) std::swap(first,second);
+            if(adjacencyList.contains(first, second)) return;
         }
-        
-        if(!flag){
-            adjacencyList[first].push_back(second);
-            if(first!=second){
-                adjacencyList[second].push_back(first);
-            }
+        adjacencyList.insert(first, second);
+        if(first!=second) adjacencyList.insert(second, first);
+    }
+
+    //edges are sorted and inserted at once, saveFlag rejects duplicates (also the ones already in the graph) like in addEdge
+    //a moved list is sorted in place
+    void addEdges(std::vector<std::pair<uint32_t, uint32_t>> &&edges, const bool saveFlag=false){
+        if(!areEdgesInBounds(edges, this->getSize())){
+            printErrorMsg(2, "One of the edges passed to a method addEdges(std::vector<std::pair<uint32_t, uint32_t>>&&, const bool) in a class ListGraph is out of bounds.");
         }
+        prepareEdges(edges, true, saveFlag);
+        this->insertPreparedEdges(edges, saveFlag);
+    }
+
+    //the list is copied only if it is not sorted already (or has duplicates when saveFlag is set)
+    void addEdges(const std::vector<std::pair<uint32_t, uint32_t>> &edges, const bool saveFlag=false){
+        if(!areEdgesPrepared(edges, true, saveFlag)){
+            this->addEdges(std::vector<std::pair<uint32_t, uint32_t>>(edges), saveFlag);
+            return;
+        }
+        if(!areEdgesInBounds(edges, this->getSize())){
+            printErrorMsg(2, "One of the edges passed to a method addEdges(const std::vector<std::pair<uint32_t, uint32_t>>&, const bool) in a class ListGraph is out of bounds.");
+        }
+        this->insertPreparedEdges(edges, saveFlag);
     }
 
     const std::vector<std::pair<uint32_t, uint32_t>> getListOfEdges() const override {
         std::vector<std::pair<uint32_t, uint32_t>>result;
         for(uint32_t i=0;i<getSize();++i) {
-            for(auto j : adjacencyList[i]) {
+            for(uint32_t j : adjacencyList.getTargets(i)) {
                 if(i<=j) {
                     result.push_back(std::pair<uint32_t, uint32_t>(i,j));
                 }
@@ -610,10 +696,9 @@ public:
 
 class MatrixGraph : public GraphUnweighted{
 private:
-    std::vector<std::vector<bool>> adjacencyMatrix;
+    BitMatrix adjacencyMatrix;
 public:
-    MatrixGraph(const uint32_t size){
-        for(uint32_t i=0;i<size;++i) adjacencyMatrix.push_back(std::vector<bool>(i+1));
+    MatrixGraph(const uint32_t size) : adjacencyMatrix(size){
         this->is_directed=false;
         this->is_weighted=false;
     }
@@ -621,7 +706,7 @@ public:
     ~MatrixGraph()=default;
 
     uint32_t getSize() const override{
-        return adjacencyMatrix.size();
+        return adjacencyMatrix.getSize();
     }
 
     bool areVertexesConnected(uint32_t first, uint32_t second) const override{
@@ -631,14 +716,11 @@ public:
         if(this->isIndexOutOfBounds(second)){
             printErrorMsg(2, "The second argument of a method areVertexesConnected(uint32_t, uint32_t) in a class MatrixGraph is out of bounds.");
         }
-        if(first<second) std::swap(first, second);
-        return adjacencyMatrix[first][second];
+        return adjacencyMatrix.get(first, second);
     }
 
     uint32_t addVertex() override{
-        uint32_t size=adjacencyMatrix.size();
-        adjacencyMatrix.push_back(std::vector<bool>(size));
-        return size;
+        return adjacencyMatrix.addRowAndColumn();
     }
 
     void deleteEdge(uint32_t first, uint32_t second) override{
@@ -648,8 +730,8 @@ public:
         if(this->isIndexOutOfBounds(second)){
             printErrorMsg(2, "The second argument of a method deleteEdge(uint32_t, uint32_t) in a class MatrixGraph is out of bounds.");
         }
-        if(first<second) std::swap(first, second);
-        adjacencyMatrix[first][second]=false;
+        adjacencyMatrix.reset(first, second);
+        adjacencyMatrix.reset(second, first);
     }
 
     const std::vector<uint32_t> getNeighbours(const uint32_t vertex) const override{
@@ -657,14 +739,41 @@ public:
             printErrorMsg(2, "The argument of a method getNeighbours(const uint32_t) in a class MatrixGraph is out of bounds.");
         }
         std::vector<uint32_t>result;
-        uint32_t i=0;
-        for(;i<=vertex;++i) {
-            if(adjacencyMatrix[vertex][i]) result.push_back(i);
+        result.reserve(adjacencyMatrix.countRow(vertex));
+        for(uint32_t i : this->getNeighboursRange(vertex)) result.push_back(i);
+        return result;
+    }
+
+    const BitRowRange getNeighboursRange(const uint32_t vertex) const{
+        if(this->isIndexOutOfBounds(vertex)){
+            printErrorMsg(2, "The argument of a method getNeighboursRange(const uint32_t) in a class MatrixGraph is out of bounds.");
         }
-        for(;i<adjacencyMatrix.size();++i) {
-            if(adjacencyMatrix[i][vertex]) result.push_back(i);
+        return BitRowRange(adjacencyMatrix.getRow(vertex), adjacencyMatrix.getWordsInRow());
+    }
+
+    //row of the adjacency matrix packed into 64-bit words, useful for word-level operations on neighbourhoods
+    const uint64_t *getAdjacencyRow(const uint32_t vertex) const{
+        if(this->isIndexOutOfBounds(vertex)){
+            printErrorMsg(2, "The argument of a method getAdjacencyRow(const uint32_t) in a class MatrixGraph is out of bounds.");
         }
-        return result;
+        return adjacencyMatrix.getRow(vertex);
+    }
+
+    const BitMatrix& getAdjacencyMatrix() const{
+        return adjacencyMatrix;
+    }
+
+    uint32_t getDegree(const uint32_t vertex) const{
+        if(this->isIndexOutOfBounds(vertex)){
+            printErrorMsg(2, "The argument of a method getDegree(const uint32_t) in a class MatrixGraph is out of bounds.");
+        }
+        return adjacencyMatrix.countRow(vertex);
+    }
+
+    uint64_t getNumberOfEdges() const{
+        uint64_t loops=0;
+        for(uint32_t i=0;i<getSize();++i) loops+=adjacencyMatrix.get(i, i);
+        return (adjacencyMatrix.count()+loops)/2;
     }
 
     void addEdge(uint32_t first, uint32_t second) override{
@@ -674,15 +783,26 @@ public:
         if(this->isIndexOutOfBounds(second)){
             printErrorMsg(2, "The second argument of a method addEdge(uint32_t, uint32_t) in a class MatrixGraph is out of bounds.");
         }
-        if(first<second) std::swap(first, second);
-        adjacencyMatrix[first][second]=true;
+        adjacencyMatrix.set(first, second);
+        adjacencyMatrix.set(second, first);
+    }
+
+    void addEdges(const std::vector<std::pair<uint32_t, uint32_t>> &edges){
+        if(!areEdgesInBounds(edges, this->getSize())){
+            printErrorMsg(2, "One of the edges passed to a method addEdges(const std::vector<std::pair<uint32_t, uint32_t>>&) in a class MatrixGraph is out of bounds.");
+        }
+        for(auto &e : edges){
+            adjacencyMatrix.set(e.first, e.second);
+            adjacencyMatrix.set(e.second, e.first);
+        }
     }
 
     const std::vector<std::pair<uint32_t, uint32_t>> getListOfEdges() const override {
         std::vector<std::pair<uint32_t, uint32_t>>result;
         for(uint32_t i=0;i<getSize();++i) {
-            for(uint32_t j=0;j<i+1;++j) {
-                if(adjacencyMatrix[i][j]) result.push_back(std::pair<uint32_t, uint32_t>(j,i));
+            for(uint32_t j : this->getNeighboursRange(i)) {
+                if(j>i) break;
+                result.push_back(std::pair<uint32_t, uint32_t>(j,i));
             }
         }
         return result;
@@ -691,10 +811,9 @@ public:
 
 class MatrixGraphDirected : public GraphUnweighted{
 private:
-    std::vector<std::vector<bool>> adjacencyMatrix;
+    BitMatrix adjacencyMatrix;
 public:
-    MatrixGraphDirected(const uint32_t size){
-        for(uint32_t i=0;i<size;++i) adjacencyMatrix.push_back(std::vector<bool>(size, false));
+    MatrixGraphDirected(const uint32_t size) : adjacencyMatrix(size){
         this->is_weighted=false;
         this->is_directed=true;
     }
@@ -702,19 +821,11 @@ public:
     ~MatrixGraphDirected()=default;
 
     void transpose(){
-        const uint32_t size=this->getSize();
-        bool tmp;
-        for(uint32_t i=0;i<size;++i){
-            for(uint32_t j=i+1;j<size;++j){
-                tmp=this->adjacencyMatrix[i][j];
-                this->adjacencyMatrix[i][j]=this->adjacencyMatrix[j][i];
-                this->adjacencyMatrix[j][i]=tmp;
-            }
-        }
+        adjacencyMatrix.transpose();
     }
 
     uint32_t getSize() const override{
-        return adjacencyMatrix.size();
+        return adjacencyMatrix.getSize();
     }
 
     bool areVertexesConnected(const uint32_t first, const uint32_t second) const override{
@@ -724,14 +835,11 @@ public:
         if(this->isIndexOutOfBounds(second)){
             printErrorMsg(2, "The second argument of a method areVertexesConnected(const uint32_t, const uint32_t) in a class MatrixGraphDirected is out of bounds.");
         }
-        return adjacencyMatrix[first][second];
+        return adjacencyMatrix.get(first, second);
     }
 
     uint32_t addVertex() override{
-        const uint32_t size=adjacencyMatrix.size();
-        for(uint32_t i=0;i<size;++i) adjacencyMatrix[i].push_back(false);
-        adjacencyMatrix.push_back(std::vector<bool>(size+1));
-        return size;
+        return adjacencyMatrix.addRowAndColumn();
     }
 
     void deleteEdge(const uint32_t first, const uint32_t second) override{
@@ -741,7 +849,7 @@ public:
         if(this->isIndexOutOfBounds(second)){
             printErrorMsg(2, "The second argument of a method deleteEdge(const uint32_t, const uint32_t) in a class MatrixGraphDirected is out of bounds.");
         }
-        adjacencyMatrix[first][second]=false;
+        adjacencyMatrix.reset(first, second);
     }
 
     const std::vector<uint32_t> getNeighbours(const uint32_t vertex) const override{
@@ -749,12 +857,40 @@ public:
             printErrorMsg(2, "The argument of a method getNeighbours(const uint32_t) in a class MatrixGraphDirected is out of bounds.");
         }
         std::vector<uint32_t>result;
-        for(uint32_t i=0;i<adjacencyMatrix[vertex].size();++i) {
-            if(adjacencyMatrix[vertex][i]) result.push_back(i);
-        }
+        result.reserve(adjacencyMatrix.countRow(vertex));
+        for(uint32_t i : this->getNeighboursRange(vertex)) result.push_back(i);
         return result;
     }
 
+    const BitRowRange getNeighboursRange(const uint32_t vertex) const{
+        if(this->isIndexOutOfBounds(vertex)){
+            printErrorMsg(2, "The argument of a method getNeighboursRange(const uint32_t) in a class MatrixGraphDirected is out of bounds.");
+        }
+        return BitRowRange(adjacencyMatrix.getRow(vertex), adjacencyMatrix.getWordsInRow());
+    }
+
+    const uint64_t *getAdjacencyRow(const uint32_t vertex) const{
+        if(this->isIndexOutOfBounds(vertex)){
+            printErrorMsg(2, "The argument of a method getAdjacencyRow(const uint32_t) in a class MatrixGraphDirected is out of bounds.");
+        }
+        return adjacencyMatrix.getRow(vertex);
+    }
+
+    const BitMatrix& getAdjacencyMatrix() const{
+        return adjacencyMatrix;
+    }
+
+    uint32_t getDegree(const uint32_t vertex) const{
+        if(this->isIndexOutOfBounds(vertex)){
+            printErrorMsg(2, "The argument of a method getDegree(const uint32_t) in a class MatrixGraphDirected is out of bounds.");
+        }
+        return adjacencyMatrix.countRow(vertex);
+    }
+
+    uint64_t getNumberOfEdges() const{
+        return adjacencyMatrix.count();
+    }
+
     void addEdge(const uint32_t first, const uint32_t second) override{
         if(this->isIndexOutOfBounds(first)){
             printErrorMsg(2, "The first argument of a method addEdge(const uint32_t, const uint32_t) in a class MatrixGraphDirected is out of bounds.");
@@ -762,14 +898,23 @@ public:
         if(this->isIndexOutOfBounds(second)){
             printErrorMsg(2, "The second argument of a method addEdge(const uint32_t, const uint32_t) in a class MatrixGraphDirected is out of bounds.");
         }
-        adjacencyMatrix[first][second]=true;
+        adjacencyMatrix.set(first, second);
+    }
+
+    void addEdges(const std::vector<std::pair<uint32_t, uint32_t>> &edges){
+        if(!areEdgesInBounds(edges, this->getSize())){
+            printErrorMsg(2, "One of the edges passed to a method addEdges(const std::vector<std::pair<uint32_t, uint32_t>>&) in a class MatrixGraphDirected is out of bounds.");
+        }
+        for(auto &e : edges){
+            adjacencyMatrix.set(e.first, e.second);
+        }
     }
 
     const std::vector<std::pair<uint32_t, uint32_t>> getListOfEdges() const override {
         std::vector<std::pair<uint32_t,uint32_t>>result;
         for(uint32_t i=0;i<getSize();++i) {
-            for(uint32_t j=0;j<getSize();++j) {
-                if(adjacencyMatrix[i][j]) result.push_back(std::pair<uint32_t, uint32_t>(i,j));
+            for(uint32_t j : this->getNeighboursRange(i)) {
+                result.push_back(std::pair<uint32_t, uint32_t>(i,j));
             }
         }
         return result;
@@ -779,28 +924,22 @@ public:
 template <typename N>
 class MatrixGraphWeightedAndDirected : public WeightedGraph<N>{
 private:
-    std::vector<std::vector<N>> adjacencyMatrix;
+    DenseMatrix<N> adjacencyMatrix;
 public:
-    MatrixGraphWeightedAndDirected(const uint32_t size, const N &max){
+    MatrixGraphWeightedAndDirected(const uint32_t size, const N &max) : adjacencyMatrix(size, max){
         this->max=max;
-        for(uint32_t i=0;i<size;++i) adjacencyMatrix.push_back(std::vector<N>(size, max));
         this->is_weighted=true;
         this->is_directed=true;
     }
 
-    ~MatrixGraphWeightedAndDirected() = default;
+    ~MatrixGraphWeightedAndDirected()=default;
 
     void transpose(){
-        uint32_t size=this->getSize();
-        for(uint32_t i=0;i<size;++i){
-            for(uint32_t j=i+1;j<size;++j){
-                std::swap(this->adjacencyMatrix[i][j], this->adjacencyMatrix[j][i]);
-            }
-        }
+        adjacencyMatrix.transpose();
     }
 
     uint32_t getSize() const override{
-        return adjacencyMatrix.size();
+        return adjacencyMatrix.getSize();
     }
 
     bool areVertexesConnected(const uint32_t first, const uint32_t second) const override{
@@ -810,16 +949,11 @@ public:
         if(this->isIndexOutOfBounds(second)){
             printErrorMsg(2, "The second argument of a method areVertexesConnected(const uint32_t, const uint32_t) in a class MatrixGraphWeightedAndDirected<N> is out of bounds.");
         }
-        return adjacencyMatrix[first][second]!=this->max;
+        return adjacencyMatrix.at(first, second)!=this->max;
     }
 
     uint32_t addVertex() override{
-        const uint32_t size=adjacencyMatrix.size();
-        for(uint32_t i=0;i<size;++i) {
-            adjacencyMatrix[i].push_back(this->max);
-        }
-        adjacencyMatrix.push_back(std::vector<N>(size+1, this->max));
-        return size;
+        return adjacencyMatrix.addRowAndColumn();
     }
 
     void deleteEdge(const uint32_t first, const uint32_t second) override{
@@ -829,7 +963,7 @@ public:
         if(this->isIndexOutOfBounds(second)){
             printErrorMsg(2, "The second argument of a method deleteEdge(const uint32_t, const uint32_t) in a class MatrixGraphWeightedAndDirected<N> is out of bounds.");
         }
-        adjacencyMatrix[first][second]=this->max;
+        adjacencyMatrix.at(first, second)=this->max;
     }
 
     const std::vector<uint32_t> getNeighbours(const uint32_t vertex) const override{
@@ -837,23 +971,45 @@ public:
             printErrorMsg(2, "The argument of a method getNeighbours(const uint32_t) in a class MatrixGraphWeightedAndDirected<N> is out of bounds.");
         }
         std::vector<uint32_t>result;
-        for(uint32_t i=0;i<adjacencyMatrix[vertex].size();++i) {
-            if(adjacencyMatrix[vertex][i]!=this->max) result.push_back(i);
-        }
+        for(uint32_t i : this->getNeighboursRange(vertex)) result.push_back(i);
         return result;
     }
 
-    const std::vector<std::pair<uint32_t, N>>getNeighboursWithWeights(const uint32_t vertex) const override {
+    const std::vector<std::pair<uint32_t, N>> getNeighboursWithWeights(const uint32_t vertex) const override{
         if(this->isIndexOutOfBounds(vertex)){
             printErrorMsg(2, "The argument of a method getNeighboursWithWeights(const uint32_t) in a class MatrixGraphWeightedAndDirected<N> is out of bounds.");
         }
         std::vector<std::pair<uint32_t, N>>result;
-        for(uint32_t i=0;i<adjacencyMatrix[vertex].size();++i) {
-            if(adjacencyMatrix[vertex][i]!=this->max) result.push_back(std::pair<uint32_t,N>(i,adjacencyMatrix[vertex][i]));
-        }
+        for(const auto &i : this->getNeighboursWithWeightsRange(vertex)) result.push_back(i);
         return result;
     }
 
+    const DenseRowTargetRange<N> getNeighboursRange(const uint32_t vertex) const{
+        if(this->isIndexOutOfBounds(vertex)){
+            printErrorMsg(2, "The argument of a method getNeighboursRange(const uint32_t) in a class MatrixGraphWeightedAndDirected<N> is out of bounds.");
+        }
+        return DenseRowTargetRange<N>(adjacencyMatrix.getRow(vertex), adjacencyMatrix.getSize(), this->max);
+    }
+
+    const DenseRowRange<N> getNeighboursWithWeightsRange(const uint32_t vertex) const{
+        if(this->isIndexOutOfBounds(vertex)){
+            printErrorMsg(2, "The argument of a method getNeighboursWithWeightsRange(const uint32_t) in a class MatrixGraphWeightedAndDirected<N> is out of bounds.");
+        }
+        return DenseRowRange<N>(adjacencyMatrix.getRow(vertex), adjacencyMatrix.getSize(), this->max);
+    }
+
+    //contiguous row of the adjacency matrix, missing edges are equal to getMax()
+    const N *getAdjacencyRow(const uint32_t vertex) const{
+        if(this->isIndexOutOfBounds(vertex)){
+            printErrorMsg(2, "The argument of a method getAdjacencyRow(const uint32_t) in a class MatrixGraphWeightedAndDirected<N> is out of bounds.");
+        }
+        return adjacencyMatrix.getRow(vertex);
+    }
+
+    const DenseMatrix<N>& getAdjacencyMatrix() const{
+        return adjacencyMatrix;
+    }
+
     void addEdge(const uint32_t first, const uint32_t second, const N &weight) override{
         if(this->isIndexOutOfBounds(first)){
             printErrorMsg(2, "The first argument of a method addEdge(const uint32_t, const uint32_t, const N) in a class MatrixGraphWeightedAndDirected<N> is out of bounds.");
@@ -861,7 +1017,16 @@ public:
         if(this->isIndexOutOfBounds(second)){
             printErrorMsg(2, "The second argument of a method addEdge(const uint32_t, const uint32_t, const N) in a class MatrixGraphWeightedAndDirected<N> is out of bounds.");
         }
-        adjacencyMatrix[first][second]=weight;
+        adjacencyMatrix.at(first, second)=weight;
+    }
+
+    void addEdges(const std::vector<std::pair<std::pair<uint32_t, uint32_t>, N>> &edges){
+        if(!areEdgesInBounds(edges, this->getSize())){
+            printErrorMsg(2, "One of the edges passed to a method addEdges(const std::vector<std::pair<std::pair<uint32_t, uint32_t>, N>>&) in a class MatrixGraphWeightedAndDirected<N> is out of bounds.");
+        }
+        for(auto &e : edges){
+            adjacencyMatrix.at(e.first.first, e.first.second)=e.second;
+        }
     }
 
     N getWeight(const uint32_t first, const uint32_t second) const override{
@@ -871,16 +1036,14 @@ public:
         if(this->isIndexOutOfBounds(second)){
             printErrorMsg(2, "The second argument of a method getWeight(const uint32_t, const uint32_t) in a class MatrixGraphWeightedAndDirected<N> is out of bounds.");
         }
-        return adjacencyMatrix[first][second];
+        return adjacencyMatrix.at(first, second);
     }
 
     const std::vector<std::pair<std::pair<uint32_t, uint32_t>, N>> getListOfEdges() const override {
         std::vector<std::pair<std::pair<uint32_t,uint32_t>,N>>result;
         for(uint32_t i=0;i<getSize();++i) {
-            for(uint32_t j=0;j<getSize();++j) {
-                if(adjacencyMatrix[i][j]!=this->max) {
-                    result.push_back(std::pair<std::pair<uint32_t,uint32_t>,N>(std::pair<uint32_t,uint32_t>(i,j),adjacencyMatrix[i][j]));
-                }
+            for(const auto &j : this->getNeighboursWithWeightsRange(i)) {
+                result.push_back(std::pair<std::pair<uint32_t,uint32_t>,N>(std::pair<uint32_t,uint32_t>(i,j.first),j.second));
             }
         }
         return result;
@@ -890,11 +1053,10 @@ public:
 template <typename N>
 class MatrixGraphWeighted : public WeightedGraph<N>{
 private:
-    std::vector<std::vector<N>> adjacencyMatrix;
+    DenseMatrix<N> adjacencyMatrix;
 public:
-    MatrixGraphWeighted(const uint32_t size, const N &max){
+    MatrixGraphWeighted(const uint32_t size, const N &max) : adjacencyMatrix(size, max){
         this->max=max;
-        for(uint32_t i=0;i<size;++i) adjacencyMatrix.push_back(std::vector<N>(i+1, max));
         this->is_weighted=true;
         this->is_directed=false;
     }
@@ -902,7 +1064,7 @@ public:
     ~MatrixGraphWeighted()=default;
 
     uint32_t getSize() const override{
-        return adjacencyMatrix.size();
+        return adjacencyMatrix.getSize();
     }
 
     bool areVertexesConnected(uint32_t first, uint32_t second) const override{
@@ -912,15 +1074,11 @@ public:
         if(this->isIndexOutOfBounds(second)){
             printErrorMsg(2, "The second argument of a method areVertexesConnected(uint32_t, uint32_t) in a class MatrixGraphWeighted<N> is out of bounds.");
         }
-        if(first<second) std::swap(first, second);
-        return adjacencyMatrix[first][second]!=this->max;
+        return adjacencyMatrix.at(first, second)!=this->max;
     }
 
     uint32_t addVertex() override{
-        const uint32_t size=adjacencyMatrix.size();
-        for(uint32_t i=0;i<size;++i) adjacencyMatrix[i].push_back(this->max);
-        adjacencyMatrix.push_back(std::vector<N>(size+1, this->max));
-        return size;
+        return adjacencyMatrix.addRowAndColumn();
     }
 
     void deleteEdge(uint32_t first, uint32_t second) override{
@@ -930,22 +1088,16 @@ public:
         if(this->isIndexOutOfBounds(second)){
             printErrorMsg(2, "The second argument of a method deleteEdge(uint32_t, uint32_t) in a class MatrixGraphWeighted<N> is out of bounds.");
         }
-        if(first<second) std::swap(first, second);
-        adjacencyMatrix[first][second]=this->max;
+        adjacencyMatrix.at(first, second)=this->max;
+        adjacencyMatrix.at(second, first)=this->max;
     }
 
     const std::vector<uint32_t> getNeighbours(const uint32_t vertex) const override{
         if(this->isIndexOutOfBounds(vertex)){
             printErrorMsg(2, "The argument of a method getNeighbours(const uint32_t) in a class MatrixGraphWeighted<N> is out of bounds.");
         }
-        uint32_t i=0;
         std::vector<uint32_t>result;
-        for(;i<=vertex;++i) {
-            if(adjacencyMatrix[vertex][i]!=this->max) result.push_back(i);
-        }
-        for(;i<adjacencyMatrix.size();++i) {
-            if(adjacencyMatrix[i][vertex]!=this->max) result.push_back(i);
-        }
+        for(uint32_t i : this->getNeighboursRange(vertex)) result.push_back(i);
         return result;
     }
 
@@ -953,15 +1105,35 @@ public:
         if(this->isIndexOutOfBounds(vertex)){
             printErrorMsg(2, "The argument of a method getNeighboursWithWeights(const uint32_t) in a class MatrixGraphWeighted<N> is out of bounds.");
         }
-        uint32_t i=0;
         std::vector<std::pair<uint32_t, N>>result;
-        for(;i<=vertex;++i) {
-            if(adjacencyMatrix[vertex][i]!=this->max) result.push_back(std::pair<uint32_t,N>(i, adjacencyMatrix[vertex][i]));
+        for(const auto &i : this->getNeighboursWithWeightsRange(vertex)) result.push_back(i);
+        return result;
+    }
+
+    const DenseRowTargetRange<N> getNeighboursRange(const uint32_t vertex) const{
+        if(this->isIndexOutOfBounds(vertex)){
+            printErrorMsg(2, "The argument of a method getNeighboursRange(const uint32_t) in a class MatrixGraphWeighted<N> is out of bounds.");
         }
-        for(;i<adjacencyMatrix.size();++i) {
-            if(adjacencyMatrix[i][vertex]!=this->max) result.push_back(std::pair<uint32_t,N>(i, adjacencyMatrix[i][vertex]));
+        return DenseRowTargetRange<N>(adjacencyMatrix.getRow(vertex), adjacencyMatrix.getSize(), this->max);
+    }
+
+    const DenseRowRange<N> getNeighboursWithWeightsRange(const uint32_t vertex) const{
+        if(this->isIndexOutOfBounds(vertex)){
+            printErrorMsg(2, "The argument of a method getNeighboursWithWeightsRange(const uint32_t) in a class MatrixGraphWeighted<N> is out of bounds.");
         }
-        return result;
+        return DenseRowRange<N>(adjacencyMatrix.getRow(vertex), adjacencyMatrix.getSize(), this->max);
+    }
+
+    //contiguous row of the adjacency matrix, missing edges are equal to getMax()
+    const N *getAdjacencyRow(const uint32_t vertex) const{
+        if(this->isIndexOutOfBounds(vertex)){
+            printErrorMsg(2, "The argument of a method getAdjacencyRow(const uint32_t) in a class MatrixGraphWeighted<N> is out of bounds.");
+        }
+        return adjacencyMatrix.getRow(vertex);
+    }
+
+    const DenseMatrix<N>& getAdjacencyMatrix() const{
+        return adjacencyMatrix;
     }
 
     void addEdge(uint32_t first, uint32_t second, const N &weight) override{
@@ -971,8 +1143,18 @@ public:
         if(this->isIndexOutOfBounds(second)){
             printErrorMsg(2, "The second argument of a method addEdge(uint32_t, uint32_t, const N) in a class MatrixGraphWeighted<N> is out of bounds.");
         }
-        if(first<second) std::swap(first, second);
-        adjacencyMatrix[first][second]=weight;
+        adjacencyMatrix.at(first, second)=weight;
+        adjacencyMatrix.at(second, first)=weight;
+    }
+
+    void addEdges(const std::vector<std::pair<std::pair<uint32_t, uint32_t>, N>> &edges){
+        if(!areEdgesInBounds(edges, this->getSize())){
+            printErrorMsg(2, "One of the edges passed to a method addEdges(const std::vector<std::pair<std::pair<uint32_t, uint32_t>, N>>&) in a class MatrixGraphWeighted<N> is out of bounds.");
+        }
+        for(auto &e : edges){
+            adjacencyMatrix.at(e.first.first, e.first.second)=e.second;
+            adjacencyMatrix.at(e.first.second, e.first.first)=e.second;
+        }
     }
 
     N getWeight(uint32_t first, uint32_t second) const override{
@@ -982,16 +1164,16 @@ public:
         if(this->isIndexOutOfBounds(second)){
             printErrorMsg(2, "The second argument of a method getWeight(uint32_t, uint32_t) in a class MatrixGraphWeighted<N> is out of bounds.");
         }
-        if(first<second) std::swap(first, second);
-        return adjacencyMatrix[first][second];
+        return adjacencyMatrix.at(first, second);
     }
 
     const std::vector<std::pair<std::pair<uint32_t, uint32_t>, N>> getListOfEdges() const override {
         std::vector<std::pair<std::pair<uint32_t,uint32_t>,N>>result;
         for(uint32_t i=0;i<getSize();++i) {
+            const N *row=adjacencyMatrix.getRow(i);
             for(uint32_t j=0;j<i+1;++j) {
-                if(adjacencyMatrix[i][j]!=this->max) {
-                    result.push_back(std::pair<std::pair<uint32_t,uint32_t>,N>(std::pair<uint32_t,uint32_t>(j,i),adjacencyMatrix[i][j]));
+                if(row[j]!=this->max) {
+                    result.push_back(std::pair<std::pair<uint32_t,uint32_t>,N>(std::pair<uint32_t,uint32_t>(j,i),row[j]));
                 }
             }
         }
@@ -6,48 +6,164 @@
 #include <cstdint>
 #include <unordered_map>
 #include <algorithm>
+#include <type_traits>
+#include <utility>
+#include <atomic>
+#include <mutex>
+#include <string>
+#include "neighbour_range.h"
+#include "bit_matrix.h"
+#include "dense_matrix.h"
+#include "thread_pool.h"
+#include "search_workspace.h"
 #include "error_info.h"
 
+//true if G maintains its in-edges (see keepInEdges in ListGraphDirected and ListGraphWeightedAndDirected)
+template<typename G, typename=void>
+struct HasInEdges : std::false_type{};
+
 template<typename G>
-bool isWeaklyConnected(G &g){
-    if(g.getSize()==0) return true;
+struct HasInEdges<G, std::void_t<decltype(std::declval<const G&>().getInNeighboursRange(0))>> : std::true_type{};
+
+//true if the neighbour ranges of G know their length (list and CSR graphs)
+template<typename R, typename=void>
+struct HasRangeSize : std::false_type{};
+
+template<typename R>
+struct HasRangeSize<R, std::void_t<decltype(std::declval<const R&>().size())>> : std::true_type{};
+
+//number of out-neighbours of a vertex, O(1) when the range knows its length
+template<typename G>
+uint32_t outDegree(const G &g, const uint32_t vertex){
+    auto range=g.getNeighboursRange(vertex);
+    if constexpr(HasRangeSize<decltype(range)>::value){
+        return range.size();
+    }
+    else{
+        uint32_t result=0;
+        for(uint32_t i : range){
+            (void)i;
+            ++result;
+        }
+        return result;
+    }
+}
+
+//in-neighbours of every vertex in CSR form, built when the graph does not maintain them
+template<typename G>
+void buildInNeighbours(const G &g, std::vector<uint64_t> &offsets, std::vector<uint32_t> &sources){
+    offsets=std::vector<uint64_t>(g.getSize()+1, 0);
+    for(uint32_t i=0;i<g.getSize();++i){
+        for(uint32_t j : g.getNeighboursRange(i)) ++offsets[j+1];
+    }
+    for(uint32_t i=0;i<g.getSize();++i) offsets[i+1]+=offsets[i];
+    sources=std::vector<uint32_t>(offsets[g.getSize()]);
+    std::vector<uint64_t>cursor(offsets.begin(), offsets.end()-1);
+    for(uint32_t i=0;i<g.getSize();++i){
+        for(uint32_t j : g.getNeighboursRange(i)) sources[cursor[j]++]=i;
+    }
+}
+
+//calls f(vertex, in_neighbours) where in_neighbours(v) returns a range of in-neighbours of v
+template<typename G, typename F>
+auto withInNeighbours(const G &g, const F &f){
+    if constexpr(HasInEdges<G>::value){
+        if(g.hasInEdges()){
+            return f([&g](const uint32_t v){
+                return g.getInNeighboursRange(v);
+            });
+        }
+    }
+    std::vector<uint64_t>offsets;
+    std::vector<uint32_t>sources;
+    buildInNeighbours(g, offsets, sources);
+    return f([&offsets, &sources](const uint32_t v){
+        return NeighbourRange(sources.data()+offsets[v], sources.data()+offsets[v+1]);
+    });
+}
+
+//true if G maintains weighted in-edges
+template<typename G, typename=void>
+struct HasInEdgesWithWeights : std::false_type{};
+
+template<typename G>
+struct HasInEdgesWithWeights<G, std::void_t<decltype(std::declval<const G&>().getInNeighboursWithWeightsRange(0))>> : std::true_type{};
+
+//calls f(in_neighbours) where in_neighbours(v) returns a range of (in-neighbour, weight) pairs of v,
+//undirected graphs use their own neighbours, directed graphs without in-edges get a temporary reverse adjacency
+template<typename G, typename F>
+auto withInNeighboursWithWeights(const G &g, const F &f){
     if(!g.isDirected()){
-        return isStronglyConnected(g);
+        return f([&g](const uint32_t v){
+            return g.getNeighboursWithWeightsRange(v);
+        });
+    }
+    if constexpr(HasInEdgesWithWeights<G>::value){
+        if(g.hasInEdges()){
+            return f([&g](const uint32_t v){
+                return g.getInNeighboursWithWeightsRange(v);
+            });
+        }
     }
-    uint32_t counter=1;
-    std::queue<uint32_t>q;
-    std::vector<std::vector<uint32_t>>v1(g.getSize(), std::vector<uint32_t>());
+    typedef decltype(g.getMax()) N;
+    std::vector<uint64_t>offsets(g.getSize()+1, 0);
     for(uint32_t i=0;i<g.getSize();++i){
-        for(uint32_t j : g.getNeighbours(i)){
-            v1[j].push_back(i);
+        for(const auto &j : g.getNeighboursWithWeightsRange(i)) ++offsets[j.first+1];
+    }
+    for(uint32_t i=0;i<g.getSize();++i) offsets[i+1]+=offsets[i];
+    std::vector<uint32_t>sources(offsets[g.getSize()]);
+    std::vector<N>weights(offsets[g.getSize()]);
+    std::vector<uint64_t>cursor(offsets.begin(), offsets.end()-1);
+    for(uint32_t i=0;i<g.getSize();++i){
+        for(const auto &j : g.getNeighboursWithWeightsRange(i)){
+            sources[cursor[j.first]]=i;
+            weights[cursor[j.first]++]=j.second;
         }
     }
-    std::vector<bool>is_visited(g.getSize(), false);
-    is_visited[0]=true;
-    q.push(0);
-    while(!q.empty()){
-        for(uint32_t i : g.getNeighbours(q.front())){
-            if(!is_visited[i]){
-                is_visited[i]=true;
-                q.push(i);
-                ++counter;
+    return f([&](const uint32_t v){
+        return WeightedNeighbourRange<N>(sources.data()+offsets[v], weights.data()+offsets[v], offsets[v+1]-offsets[v]);
+    });
+}
+
+template<typename G>
+bool isStronglyConnected(const G &g);
+
+template<typename G>
+bool isWeaklyConnected(const G &g){
+    if(g.getSize()==0) return true;
+    if(!g.isDirected()){
+        return isStronglyConnected(g);
+    }
+    return withInNeighbours(g, [&g](const auto &in_neighbours){
+        uint32_t counter=1;
+        std::queue<uint32_t>q;
+        std::vector<bool>is_visited(g.getSize(), false);
+        is_visited[0]=true;
+        q.push(0);
+        while(!q.empty()){
+            for(uint32_t i : g.getNeighboursRange(q.front())){
+                if(!is_visited[i]){
+                    is_visited[i]=true;
+                    q.push(i);
+                    ++counter;
+                }
             }
-        }
-        for(uint32_t i : v1[q.front()]){
-            if(!is_visited[i]){
-                is_visited[i]=true;
-                q.push(i);
-                ++counter;
+            for(uint32_t i : in_neighbours(q.front())){
+                if(!is_visited[i]){
+                    is_visited[i]=true;
+                    q.push(i);
+                    ++counter;
+                }
             }
+            q.pop();
         }
-        q.pop();
-    }
-    if(counter==g.getSize()) return true;
-    return false;
+        return counter==g.getSize();
+    });
 }
 
+//the graph is not modified, reverse edges come from the in-edges of the graph or from a temporary reverse adjacency
 template<typename G>
-bool isStronglyConnected(G &g){
+bool isStronglyConnected(const G &g){
     if(g.getSize()==0) return true;
     uint32_t counter=1;
     std::queue<uint32_t>q;
@@ -55,7 +171,7 @@ bool isStronglyConnected(G &g){
     v[0]=true;
     q.push(0);
     while(!q.empty()){
-        for(uint32_t i : g.getNeighbours(q.front())){
+        for(uint32_t i : g.getNeighboursRange(q.front())){
             if(!v[i]){
                 v[i]=true;
                 q.push(i);
@@ -68,24 +184,23 @@ bool isStronglyConnected(G &g){
     if(!g.isDirected()) return true;
 
     //for directed Gs
-    g.transpose();
-    counter=1;
-    for(uint32_t i=0;i<g.getSize();++i) v[i]=false;
-    v[0]=true;
-    q.push(0);
-    while(!q.empty()){
-        for(uint32_t i : g.getNeighbours(q.front())){
-            if(!v[i]){
-                v[i]=true;
-                q.push(i);
-                ++counter;
+    return withInNeighbours(g, [&](const auto &in_neighbours){
+        counter=1;
+        for(uint32_t i=0;i<g.getSize();++i) v[i]=false;
+        v[0]=true;
+        q.push(0);
+        while(!q.empty()){
+            for(uint32_t i : in_neighbours(q.front())){
+                if(!v[i]){
+                    v[i]=true;
+                    q.push(i);
+                    ++counter;
+                }
             }
+            q.pop();
         }
-        q.pop();
-    }
-    g.transpose();
-    if(counter==g.getSize()) return true;
-    return false;
+        return counter==g.getSize();
+    });
 }
 
 template<typename G>
@@ -102,7 +217,7 @@ bool isBipartite(const G &g){
             q.push(k);
             tmp[k]=1;
             while(!q.empty()){
-                for(uint32_t i : g.getNeighbours(q.front())){
+                for(uint32_t i : g.getNeighboursRange(q.front())){
                     if(tmp[i]==0){
                         tmp[q.front()]==1 ? tmp[i]=2 : tmp[i]=1;
                         q.push(i);
@@ -130,7 +245,7 @@ int32_t bfs(const G &g, const uint32_t src, const uint32_t destination){
     tmp[src]=0;
     q.push(src);
     while(!q.empty()){
-        for(uint32_t i : g.getNeighbours(q.front())){
+        for(uint32_t i : g.getNeighboursRange(q.front())){
             if(tmp[i]==-1){
                 if(i==destination) return tmp[q.front()]+1;
                 tmp[i]=tmp[q.front()]+1;
@@ -169,7 +284,7 @@ std::unordered_map<uint32_t, int32_t>* bfs(const G& g, const uint32_t src, const
     }
     q.push(src);
     while(!q.empty() && counter!=destinations.size()){
-        for(uint32_t i : g.getNeighbours(q.front())){
+        for(uint32_t i : g.getNeighboursRange(q.front())){
             if(tmp[i]==-1){
                 tmp[i]=tmp[q.front()]+1;
                 q.push(i);
@@ -194,7 +309,7 @@ std::vector<int32_t>* bfs(const G &g, const uint32_t src){
     q.push(src);
     result->at(src)=0;
     while(!q.empty()){
-        for(uint32_t i : g.getNeighbours(q.front())){
+        for(uint32_t i : g.getNeighboursRange(q.front())){
             if(result->at(i)==-1){
                 result->at(i)=result->at(q.front())+1;
                 q.push(i);
@@ -205,6 +320,286 @@ std::vector<int32_t>* bfs(const G &g, const uint32_t src){
     return result;
 }
 
+//direction-optimizing BFS: top-down steps expand a queue, bottom-up steps let every unvisited vertex look for a parent in a frontier bitmap
+//switches to bottom-up when the edges of the frontier exceed 1/alpha of the edges of unvisited vertexes, and back when the frontier has less than V/beta vertexes
+template<typename G, typename F>
+std::vector<int32_t>* bfsDirectionOptimizing(const G &g, const uint32_t src, const F &in_neighbours, const uint32_t alpha, const uint32_t beta){
+    const uint32_t size=g.getSize();
+    auto result=new std::vector<int32_t>(size, -1);
+    std::vector<int32_t> &distance=*result;
+    std::vector<uint32_t>frontier, next;
+    std::vector<uint64_t>bits((size+63)/64, 0), next_bits((size+63)/64, 0);
+    uint64_t unexplored=0;
+    for(uint32_t i=0;i<size;++i) unexplored+=outDegree(g, i);
+    distance[src]=0;
+    frontier.push_back(src);
+    uint64_t frontier_edges=outDegree(g, src);
+    unexplored-=frontier_edges;
+    uint32_t frontier_size=1;
+    bool bottom_up=false;
+    for(int32_t level=0;frontier_size>0;++level){
+        if(!bottom_up && frontier_edges>unexplored/alpha){
+            std::fill(bits.begin(), bits.end(), 0);
+            for(uint32_t i : frontier) bits[i>>6]|=1ull<<(i&63);
+            bottom_up=true;
+        }
+        else if(bottom_up && frontier_size<size/beta){
+            frontier.clear();
+            for(uint32_t w=0;w<bits.size();++w){
+                for(uint64_t b=bits[w];b;b&=b-1) frontier.push_back((w<<6)+countTrailingZeros(b));
+            }
+            bottom_up=false;
+        }
+        frontier_edges=0;
+        if(bottom_up){
+            std::fill(next_bits.begin(), next_bits.end(), 0);
+            frontier_size=0;
+            for(uint32_t v=0;v<size;++v){
+                if(distance[v]!=-1) continue;
+                for(uint32_t u : in_neighbours(v)){
+                    if(bits[u>>6]&(1ull<<(u&63))){
+                        distance[v]=level+1;
+                        next_bits[v>>6]|=1ull<<(v&63);
+                        ++frontier_size;
+                        const uint32_t degree=outDegree(g, v);
+                        frontier_edges+=degree;
+                        unexplored-=degree;
+                        break;
+                    }
+                }
+            }
+            bits.swap(next_bits);
+        }
+        else{
+            next.clear();
+            for(uint32_t u : frontier){
+                for(uint32_t v : g.getNeighboursRange(u)){
+                    if(distance[v]==-1){
+                        distance[v]=level+1;
+                        next.push_back(v);
+                        const uint32_t degree=outDegree(g, v);
+                        frontier_edges+=degree;
+                        unexplored-=degree;
+                    }
+                }
+            }
+            frontier.swap(next);
+            frontier_size=frontier.size();
+        }
+    }
+    return result;
+}
+
+//returns the same distances as bfs(g, src), examines far fewer edges on graphs with a small diameter
+//directed graphs need in-edges, without keepInEdges a temporary reverse adjacency is built
+template<typename G>
+std::vector<int32_t>* bfs_direction_optimizing(const G &g, const uint32_t src, const uint32_t alpha=15, const uint32_t beta=18){
+    if(src>=g.getSize()){
+        printErrorMsg(2, "Agrument src in function bfs_direction_optimizing(const G&, const uint32_t, const uint32_t, const uint32_t) is outside of the graph.");
+    }
+    if(alpha==0 || beta==0){
+        printErrorMsg(2, "Arguments alpha and beta in function bfs_direction_optimizing(const G&, const uint32_t, const uint32_t, const uint32_t) have to be positive.");
+    }
+    if(!g.isDirected()){
+        return bfsDirectionOptimizing(g, src, [&g](const uint32_t v){
+            return g.getNeighboursRange(v);
+        }, alpha, beta);
+    }
+    return withInNeighbours(g, [&](const auto &in_neighbours){
+        return bfsDirectionOptimizing(g, src, in_neighbours, alpha, beta);
+    });
+}
+
+#define PARALLEL_FRONTIER_CHUNK 256
+
+//frontiers are cut into chunks of at most PARALLEL_FRONTIER_CHUNK vertexes, but into at least 4 chunks per thread
+inline uint64_t frontierChunkSize(const uint64_t frontier, const uint32_t threads){
+    return std::max<uint64_t>(1, std::min<uint64_t>(PARALLEL_FRONTIER_CHUNK, frontier/(4*(uint64_t)threads)));
+}
+
+//level-synchronous BFS on a thread pool, every level is cut into chunks of the frontier handed out dynamically (parallelForChunks),
+//so a thread that drew a vertex of high degree does not hold up the level, and every chunk writes to its own slot
+//a vertex is claimed with an atomic minimum of the frontier positions of the vertexes that reach it, so its parent is the one
+//the sequential bfs would use, and the slots are concatenated in chunk order (prefix sum), which keeps the order of the sequential queue
+//stops after the level on which destination is reached (UINT32_MAX - never), parent is optional
+template<typename G>
+void parallelBfs(const G &g, const uint32_t src, ThreadPool &pool, std::vector<int32_t> &distance, std::vector<int32_t> *parent, const uint32_t destination){
+    const uint32_t size=g.getSize();
+    const uint32_t threads=pool.getSize();
+    distance.assign(size, -1);
+    if(parent) parent->assign(size, -1);
+    std::vector<std::atomic<uint64_t>>visited((size+63)/64);
+    std::vector<std::atomic<uint32_t>>claim(size);
+    for(auto &w : visited) w.store(0, std::memory_order_relaxed);
+    for(auto &c : claim) c.store(UINT32_MAX, std::memory_order_relaxed);
+    std::vector<std::vector<std::pair<uint32_t, uint32_t>>>local;
+    std::vector<uint64_t>offsets;
+    std::vector<uint32_t>frontier(1, src), next;
+    distance[src]=0;
+    visited[src>>6].fetch_or(1ull<<(src&63), std::memory_order_relaxed);
+    for(int32_t level=0;!frontier.empty() && (destination==UINT32_MAX || distance[destination]==-1);++level){
+        const uint64_t chunk=frontierChunkSize(frontier.size(), threads);
+        const uint64_t chunks=(frontier.size()+chunk-1)/chunk;
+        if(local.size()<chunks) local.resize(chunks);
+        offsets.assign(chunks+1, 0);
+        parallelForChunks(pool, 0, frontier.size(), chunk, [&](const uint64_t c, const uint64_t b, const uint64_t e){
+            for(uint64_t i=b;i<e;++i){
+                for(uint32_t v : g.getNeighboursRange(frontier[i])){
+                    if(visited[v>>6].load(std::memory_order_relaxed)&(1ull<<(v&63))) continue;
+                    uint32_t current=claim[v].load(std::memory_order_relaxed);
+                    while(i<current && !claim[v].compare_exchange_weak(current, i, std::memory_order_relaxed));
+                    if(i<current) local[c].push_back(std::pair<uint32_t, uint32_t>(v, i));
+                }
+            }
+        });
+        parallelForChunks(pool, 0, chunks, 1, [&](const uint64_t c, const uint64_t, const uint64_t){
+            uint64_t count=0;
+            for(auto &entry : local[c]){
+                if(claim[entry.first].load(std::memory_order_relaxed)==entry.second) local[c][count++]=entry;
+            }
+            local[c].resize(count);
+            offsets[c+1]=count;
+        });
+        for(uint64_t c=0;c<chunks;++c) offsets[c+1]+=offsets[c];
+        next.resize(offsets[chunks]);
+        parallelForChunks(pool, 0, chunks, 1, [&](const uint64_t c, const uint64_t, const uint64_t){
+            uint64_t position=offsets[c];
+            for(auto &entry : local[c]){
+                const uint32_t v=entry.first;
+                next[position++]=v;
+                distance[v]=level+1;
+                if(parent) (*parent)[v]=frontier[entry.second];
+                visited[v>>6].fetch_or(1ull<<(v&63), std::memory_order_relaxed);
+            }
+            local[c].clear();
+        });
+        frontier.swap(next);
+    }
+}
+
+//returns the same distances as bfs(g, src), threads=0 uses every hardware thread
+template<typename G>
+std::vector<int32_t>* parallel_bfs(const G &g, const uint32_t src, const uint32_t threads=0){
+    if(src>=g.getSize()){
+        printErrorMsg(2, "Agrument src in function parallel_bfs(const G&, const uint32_t, const uint32_t) is outside of the graph.");
+    }
+    ThreadPool pool(threads);
+    auto result=new std::vector<int32_t>();
+    parallelBfs(g, src, pool, *result, nullptr, UINT32_MAX);
+    return result;
+}
+
+//returns the same path as bfs_path(g, src, destination) or nullptr if there is no path, threads=0 uses every hardware thread
+template<typename G>
+std::vector<uint32_t>* parallel_bfs_path(const G &g, const uint32_t src, const uint32_t destination, const uint32_t threads=0){
+    if(src>=g.getSize()){
+        printErrorMsg(2, "Agrument src in function parallel_bfs_path(const G&, const uint32_t, const uint32_t, const uint32_t) is outside of the graph.");
+    }
+    if(destination>=g.getSize()){
+        printErrorMsg(2, "Agrument destination in function parallel_bfs_path(const G&, const uint32_t, const uint32_t, const uint32_t) is outside of the graph.");
+    }
+    ThreadPool pool(threads);
+    std::vector<int32_t>distance, parent;
+    parallelBfs(g, src, pool, distance, &parent, destination);
+    if(distance[destination]==-1) return nullptr;
+    auto result=new std::vector<uint32_t>();
+    for(int32_t i=destination;i!=-1;i=parent[i]) result->push_back(i);
+    std::reverse(result->begin(), result->end());
+    return result;
+}
+
+//bidirectional BFS: expands a whole level of the smaller frontier (forward from src, backward from destination over in-neighbours)
+//and stops after the first level on which the two searches meet, returns the number of edges on a shortest path or -1
+//parent[0] and parent[1] receive forward and backward parents and meeting the vertex on the shortest path where the searches met
+template<typename G, typename F>
+int32_t bidirectionalBfs(const G &g, const uint32_t src, const uint32_t destination, const F &in_neighbours,
+    std::vector<int32_t> *parent, uint32_t &meeting){
+    meeting=src;
+    if(src==destination) return 0;
+    std::vector<int32_t>distance[2]={std::vector<int32_t>(g.getSize(), -1), std::vector<int32_t>(g.getSize(), -1)};
+    std::vector<uint32_t>frontier[2]={std::vector<uint32_t>(1, src), std::vector<uint32_t>(1, destination)};
+    std::vector<uint32_t>next;
+    distance[0][src]=0;
+    distance[1][destination]=0;
+    int32_t best=-1;
+    while(!frontier[0].empty() && !frontier[1].empty()){
+        const uint32_t side=frontier[0].size()<=frontier[1].size() ? 0 : 1;
+        next.clear();
+        for(uint32_t u : frontier[side]){
+            auto visit=[&](const uint32_t v){
+                if(distance[side][v]!=-1) return;
+                distance[side][v]=distance[side][u]+1;
+                if(parent) parent[side][v]=u;
+                next.push_back(v);
+                if(distance[1-side][v]!=-1){
+                    const int32_t length=distance[side][v]+distance[1-side][v];
+                    if(best==-1 || length<best){
+                        best=length;
+                        meeting=v;
+                    }
+                }
+            };
+            if(side==0){
+                for(uint32_t v : g.getNeighboursRange(u)) visit(v);
+            }
+            else{
+                for(uint32_t v : in_neighbours(u)) visit(v);
+            }
+        }
+        if(best!=-1) return best;
+        frontier[side].swap(next);
+    }
+    return -1;
+}
+
+template<typename G, typename F>
+auto withReverseNeighbours(const G &g, const F &f){
+    if(!g.isDirected()){
+        return f([&g](const uint32_t v){
+            return g.getNeighboursRange(v);
+        });
+    }
+    return withInNeighbours(g, f);
+}
+
+//returns the same distance as bfs(g, src, destination), directed graphs should keep their in-edges (keepInEdges),
+//otherwise a temporary reverse adjacency is built for every call
+template<typename G>
+int32_t bidirectional_bfs(const G &g, const uint32_t src, const uint32_t destination){
+    if(src>=g.getSize()){
+        printErrorMsg(2, "Agrument src in function bidirectional_bfs(const G&, const uint32_t, const uint32_t) is outside of the graph.");
+    }
+    if(destination>=g.getSize()){
+        printErrorMsg(2, "Agrument destination in function bidirectional_bfs(const G&, const uint32_t, const uint32_t) is outside of the graph.");
+    }
+    return withReverseNeighbours(g, [&](const auto &in_neighbours){
+        uint32_t meeting;
+        return bidirectionalBfs(g, src, destination, in_neighbours, nullptr, meeting);
+    });
+}
+
+//returns a shortest path from src to destination or nullptr if there is none, the path can differ from bfs_path when there are several
+template<typename G>
+std::vector<uint32_t>* bidirectional_bfs_path(const G &g, const uint32_t src, const uint32_t destination){
+    if(src>=g.getSize()){
+        printErrorMsg(2, "Agrument src in function bidirectional_bfs_path(const G&, const uint32_t, const uint32_t) is outside of the graph.");
+    }
+    if(destination>=g.getSize()){
+        printErrorMsg(2, "Agrument destination in function bidirectional_bfs_path(const G&, const uint32_t, const uint32_t) is outside of the graph.");
+    }
+    std::vector<int32_t>parent[2]={std::vector<int32_t>(g.getSize(), -1), std::vector<int32_t>(g.getSize(), -1)};
+    uint32_t meeting;
+    const int32_t length=withReverseNeighbours(g, [&](const auto &in_neighbours){
+        return bidirectionalBfs(g, src, destination, in_neighbours, parent, meeting);
+    });
+    if(length==-1) return nullptr;
+    auto result=new std::vector<uint32_t>();
+    for(int32_t i=meeting;i!=-1;i=parent[0][i]) result->push_back(i);
+    std::reverse(result->begin(), result->end());
+    for(int32_t i=parent[1][meeting];i!=-1;i=parent[1][i]) result->push_back(i);
+    return result;
+}
+
 template<typename G, typename F>
 int32_t bfs_with_f(const G &g, const uint32_t src, const uint32_t destination, const F &fun){
     if(src>=g.getSize()){
@@ -219,7 +614,7 @@ int32_t bfs_with_f(const G &g, const uint32_t src, const uint32_t destination, c
     tmp[src]=0;
     q.push(src);
     while(!q.empty()){
-        for(uint32_t i : g.getNeighbours(q.front())){
+        for(uint32_t i : g.getNeighboursRange(q.front())){
             if(tmp[i]==-1 && fun(i, tmp[q.front()]+1)){
                 if(i==destination) return tmp[q.front()]+1;
                 tmp[i]=tmp[q.front()]+1;
@@ -258,7 +653,7 @@ std::unordered_map<uint32_t, int32_t>* bfs_with_f(const G& g, const uint32_t src
     }
     q.push(src);
     while(!q.empty() && counter!=destinations.size()){
-        for(uint32_t i : g.getNeighbours(q.front())){
+        for(uint32_t i : g.getNeighboursRange(q.front())){
             if(tmp[i]==-1 && fun(i, tmp[q.front()]+1)){
                 tmp[i]=tmp[q.front()]+1;
                 q.push(i);
@@ -283,7 +678,7 @@ std::vector<int32_t>* bfs_with_f(const G &g, const uint32_t src, const F &fun){
     q.push(src);
     result->at(src)=0;
     while(!q.empty()){
-        for(uint32_t i : g.getNeighbours(q.front())){
+        for(uint32_t i : g.getNeighboursRange(q.front())){
             if(result->at(i)==-1 && fun(i, result->at(q.front()+1))){
                 result->at(i)=result->at(q.front())+1;
                 q.push(i);
@@ -305,7 +700,7 @@ void bfs_functor(const G &g, const uint32_t src, F &f){
     is_visited[src]=true;
     while(!q.empty()){
         f(q.front());
-        for(uint32_t i : g.getNeighbours(q.front())){
+        for(uint32_t i : g.getNeighboursRange(q.front())){
             if(!is_visited[i]){
                 is_visited[i]=true;
                 q.push(i);
@@ -315,6 +710,76 @@ void bfs_functor(const G &g, const uint32_t src, F &f){
     }
 }
 
+#define MULTI_SOURCE_BFS_WORDS 4
+
+//multi-source BFS: up to 64*MULTI_SOURCE_BFS_WORDS sources are traversed together, every vertex keeps bitsets of sources
+//that have seen it and that visit it on the current level, so a vertex shared by many frontiers is expanded once per level
+//calls f(source_index, vertex, distance) once for every vertex reachable from sources[source_index]
+template<typename G, typename F>
+void multi_source_bfs_functor(const G &g, const std::vector<uint32_t> &sources, F &f){
+    const uint32_t size=g.getSize();
+    for(uint32_t s : sources){
+        if(s>=size){
+            printErrorMsg(2, "Member of sources argument in function multi_source_bfs_functor(const G&, const std::vector<uint32_t>&, F&) is outside of the graph.");
+        }
+    }
+    const uint32_t batch=64*MULTI_SOURCE_BFS_WORDS;
+    for(uint32_t first=0;first<sources.size();first+=batch){
+        const uint32_t count=std::min<uint64_t>(batch, sources.size()-first);
+        const uint32_t words=(count+63)/64;
+        std::vector<uint64_t>seen((uint64_t)size*words, 0), visit((uint64_t)size*words, 0), next((uint64_t)size*words, 0);
+        for(uint32_t k=0;k<count;++k){
+            const uint64_t idx=(uint64_t)sources[first+k]*words+k/64;
+            visit[idx]|=1ull<<(k%64);
+            seen[idx]|=1ull<<(k%64);
+            f(first+k, sources[first+k], 0);
+        }
+        for(int32_t level=1;;++level){
+            for(uint32_t v=0;v<size;++v){
+                const uint64_t *mask=visit.data()+(uint64_t)v*words;
+                uint64_t any=0;
+                for(uint32_t w=0;w<words;++w) any|=mask[w];
+                if(!any) continue;
+                for(uint32_t n : g.getNeighboursRange(v)){
+                    uint64_t *target=next.data()+(uint64_t)n*words;
+                    for(uint32_t w=0;w<words;++w) target[w]|=mask[w];
+                }
+            }
+            bool active=false;
+            for(uint32_t v=0;v<size;++v){
+                uint64_t *mask=next.data()+(uint64_t)v*words;
+                uint64_t *was_seen=seen.data()+(uint64_t)v*words;
+                for(uint32_t w=0;w<words;++w){
+                    mask[w]&=~was_seen[w];
+                    if(!mask[w]) continue;
+                    active=true;
+                    was_seen[w]|=mask[w];
+                    for(uint64_t b=mask[w];b;b&=b-1) f(first+w*64+countTrailingZeros(b), v, level);
+                }
+            }
+            if(!active) break;
+            visit.swap(next);
+            std::fill(next.begin(), next.end(), 0);
+        }
+    }
+}
+
+//result[k] is equal to the result of bfs(g, sources[k])
+template<typename G>
+std::vector<std::vector<int32_t>>* multi_source_bfs(const G &g, const std::vector<uint32_t> &sources){
+    for(uint32_t s : sources){
+        if(s>=g.getSize()){
+            printErrorMsg(2, "Member of sources argument in function multi_source_bfs(const G&, const std::vector<uint32_t>&) is outside of the graph.");
+        }
+    }
+    auto result=new std::vector<std::vector<int32_t>>(sources.size(), std::vector<int32_t>(g.getSize(), -1));
+    auto f=[result](const uint32_t k, const uint32_t vertex, const int32_t distance){
+        (*result)[k][vertex]=distance;
+    };
+    multi_source_bfs_functor(g, sources, f);
+    return result;
+}
+
 template<typename G>
 std::vector<uint32_t>* bfs_path(const G &g, const uint32_t src, const uint32_t destination){
     if(src>=g.getSize()){
@@ -334,7 +799,7 @@ std::vector<uint32_t>* bfs_path(const G &g, const uint32_t src, const uint32_t d
     tmp[src]=-1;
     q.push(src);
     while(!q.empty()){
-        for(uint32_t i : g.getNeighbours(q.front())){
+        for(uint32_t i : g.getNeighboursRange(q.front())){
             if(tmp[i]==-2){
                 tmp[i]=q.front();
                 if(i==destination){
@@ -378,7 +843,7 @@ std::vector<uint32_t>* bfs_path_with_f(const G &g, const uint32_t src, const uin
     q.push(src);
     tmp[src]=-1;
     while (!q.empty() && q.front()!=destination) {
-        for(uint32_t i : g.getNeighbours(q.front())) {
+        for(uint32_t i : g.getNeighboursRange(q.front())) {
             if(tmp[i]==-2 && fun(i, tmp_2[q.front()]+1)) {
                 tmp[i]=q.front();
                 tmp_2[i]=tmp_2[q.front()]+1;
@@ -406,7 +871,7 @@ namespace{
         if(is_visited[src]) return;
         is_visited[src]=true;
         f(src);
-        for(uint32_t i : g.getNeighbours(src)){
+        for(uint32_t i : g.getNeighboursRange(src)){
             dfs_preorder(g, i, f, is_visited);
         }
     }
@@ -415,7 +880,7 @@ namespace{
     void dfs_postorder(const G &g, const uint32_t src, F &f, std::vector<bool>&is_visited){
         if(is_visited[src]) return;
         is_visited[src]=true;
-        for(uint32_t i : g.getNeighbours(src)){
+        for(uint32_t i : g.getNeighboursRange(src)){
             dfs_postorder(g, i, f, is_visited);
         }
         f(src);
@@ -467,7 +932,7 @@ std::vector<std::pair<uint32_t, uint32_t>>* prim(const G &g, const uint32_t src)
         top=pq.top().first;
         pq.pop();
         mstSet[top]=true;
-        for(auto &i : g.getNeighboursWithWeights(top)){
+        for(const auto &i : g.getNeighboursWithWeightsRange(top)){
             if(!mstSet[i.first] && i.second<keys[i.first]){
                 keys[i.first]=i.second;
                 pq.push(i.first, i.second);
@@ -537,7 +1002,7 @@ N dijkstra(const G &g, const uint32_t src, const uint32_t destination) {
         top=pq.top().first;
         pq.pop();
         is_visited[top]=true;
-        for(auto &i : g.getNeighboursWithWeights(top)) {
+        for(const auto &i : g.getNeighboursWithWeightsRange(top)) {
             if(!is_visited[i.first] && distance[i.first]>distance[top]+i.second) {
                 distance[i.first]=distance[top]+i.second;
                 pq.push(i.first, distance[i.first]);
@@ -547,6 +1012,253 @@ N dijkstra(const G &g, const uint32_t src, const uint32_t destination) {
     return distance[destination];
 }
 
+//bidirectional Dijkstra: settles the vertex with the smaller key of the forward (from src) and backward (from destination, over in-edges) queues
+//and stops when the sum of both top keys is at least the best distance found through an edge between the two searches
+//returns the best distance (max if there is no path), parent[0] and parent[1] receive forward and backward parents and
+//meeting the edge (last vertex of the forward part, first vertex of the backward part) of the best path
+template<typename G, typename N, typename PQ, typename F>
+N bidirectionalDijkstra(const G &g, const uint32_t src, const uint32_t destination, const F &in_neighbours,
+    std::vector<int32_t> *parent, std::pair<uint32_t, uint32_t> &meeting){
+    const N max=g.getMax();
+    meeting=std::pair<uint32_t, uint32_t>(src, src);
+    if(src==destination) return 0;
+    std::vector<N>distance[2]={std::vector<N>(g.getSize(), max), std::vector<N>(g.getSize(), max)};
+    std::vector<bool>is_visited[2]={std::vector<bool>(g.getSize(), false), std::vector<bool>(g.getSize(), false)};
+    PQ pq[2]={PQ(g.getSize()), PQ(g.getSize())};
+    distance[0][src]=0;
+    distance[1][destination]=0;
+    pq[0].push(src, 0);
+    pq[1].push(destination, 0);
+    N best=max;
+    while(!pq[0].empty() && !pq[1].empty()){
+        const N top_forward=pq[0].top().second;
+        const N top_backward=pq[1].top().second;
+        if(best!=max && top_forward+top_backward>=best) break;
+        const uint32_t side=top_forward<=top_backward ? 0 : 1;
+        const uint32_t top=pq[side].top().first;
+        pq[side].pop();
+        is_visited[side][top]=true;
+        auto relax=[&](const uint32_t v, const N &weight){
+            if(!is_visited[side][v] && distance[side][v]>distance[side][top]+weight){
+                distance[side][v]=distance[side][top]+weight;
+                if(parent) parent[side][v]=top;
+                pq[side].push(v, distance[side][v]);
+            }
+            if(distance[1-side][v]!=max && distance[side][top]+weight+distance[1-side][v]<best){
+                best=distance[side][top]+weight+distance[1-side][v];
+                meeting=side==0 ? std::pair<uint32_t, uint32_t>(top, v) : std::pair<uint32_t, uint32_t>(v, top);
+            }
+        };
+        if(side==0){
+            for(const auto &i : g.getNeighboursWithWeightsRange(top)) relax(i.first, i.second);
+        }
+        else{
+            for(const auto &i : in_neighbours(top)) relax(i.first, i.second);
+        }
+    }
+    return best;
+}
+
+//returns the same distance as dijkstra<G, N, PQ>(g, src, destination), directed graphs should keep their in-edges (keepInEdges),
+//otherwise a temporary reverse adjacency is built for every call
+template<typename G, typename N, typename PQ>
+N bidirectional_dijkstra(const G &g, const uint32_t src, const uint32_t destination){
+    if(src>=g.getSize()){
+        printErrorMsg(2, "Agrument src in function bidirectional_dijkstra(const G&, const uint32_t, const uint32_t) is outside of the graph.");
+    }
+    if(destination>=g.getSize()){
+        printErrorMsg(2, "Agrument destination in function bidirectional_dijkstra(const G&, const uint32_t, const uint32_t) is outside of the graph.");
+    }
+    return withInNeighboursWithWeights(g, [&](const auto &in_neighbours){
+        std::pair<uint32_t, uint32_t>meeting;
+        return bidirectionalDijkstra<G, N, PQ>(g, src, destination, in_neighbours, nullptr, meeting);
+    });
+}
+
+//returns a shortest path like dijkstra_path<G, N, PQ>(g, src, destination) or nullptr, the paths can differ when there are several shortest paths
+template<typename G, typename N, typename PQ>
+std::vector<uint32_t>* bidirectional_dijkstra_path(const G &g, const uint32_t src, const uint32_t destination){
+    if(src>=g.getSize()){
+        printErrorMsg(2, "Agrument src in function bidirectional_dijkstra_path(const G&, const uint32_t, const uint32_t) is outside of the graph.");
+    }
+    if(destination>=g.getSize()){
+        printErrorMsg(2, "Agrument destination in function bidirectional_dijkstra_path(const G&, const uint32_t, const uint32_t) is outside of the graph.");
+    }
+    std::vector<int32_t>parent[2]={std::vector<int32_t>(g.getSize(), -1), std::vector<int32_t>(g.getSize(), -1)};
+    std::pair<uint32_t, uint32_t>meeting;
+    const N result=withInNeighboursWithWeights(g, [&](const auto &in_neighbours){
+        return bidirectionalDijkstra<G, N, PQ>(g, src, destination, in_neighbours, parent, meeting);
+    });
+    if(result==g.getMax()) return nullptr;
+    auto path=new std::vector<uint32_t>();
+    for(int32_t i=meeting.first;i!=-1;i=parent[0][i]) path->push_back(i);
+    std::reverse(path->begin(), path->end());
+    if(meeting.second!=meeting.first){
+        for(int32_t i=meeting.second;i!=-1;i=parent[1][i]) path->push_back(i);
+    }
+    return path;
+}
+
+//lowers target to value if value is smaller, returns true if it did
+template<typename N>
+bool atomicMin(std::atomic<N> &target, const N &value){
+    N current=target.load(std::memory_order_relaxed);
+    while(value<current){
+        if(target.compare_exchange_weak(current, value, std::memory_order_relaxed)) return true;
+    }
+    return false;
+}
+
+#define DELTA_STEPPING_FIRST_BUCKETS 64
+
+//buckets of one thread in delta_stepping: a circular array of vertex lists indexed by distance/delta, every stored bucket number
+//lies in <base;base+array size) where base is the bucket being processed; the array doubles (as in BucketQueue) when a farther
+//bucket is needed, entries are not removed when a distance drops, so a list can hold stale vertexes that are skipped later
+class DeltaSteppingBuckets{
+private:
+    std::vector<std::vector<uint32_t>>slots;
+
+    void grow(const uint64_t base, const uint64_t bucket){
+        uint64_t size=this->slots.size();
+        while(bucket-base>=size) size*=2;
+        std::vector<std::vector<uint32_t>>tmp(size);
+        for(uint64_t s=0;s<this->slots.size();++s){
+            const uint64_t b=base+((s-base)&(this->slots.size()-1));
+            tmp[b&(size-1)].swap(this->slots[s]);
+        }
+        this->slots.swap(tmp);
+    }
+
+public:
+    uint64_t count;
+
+    DeltaSteppingBuckets() : slots(DELTA_STEPPING_FIRST_BUCKETS){
+        this->count=0;
+    }
+
+    void push(const uint64_t base, const uint64_t bucket, const uint32_t vertex){
+        if(bucket-base>=this->slots.size()) this->grow(base, bucket);
+        this->slots[bucket&(this->slots.size()-1)].push_back(vertex);
+        ++this->count;
+    }
+
+    //bucket has to be in <base;base+array size)
+    std::vector<uint32_t>& get(const uint64_t bucket){
+        return this->slots[bucket&(this->slots.size()-1)];
+    }
+};
+
+//delta-stepping: vertexes are kept in buckets of width delta, the lowest bucket is emptied by repeated parallel relaxations
+//of light edges (weight <= delta), then heavy edges of every vertex removed from it are relaxed once in parallel
+//every thread keeps its own buckets (DeltaSteppingBuckets), distances are lowered with an atomic compare-and-swap and stale
+//or repeated vertexes are filtered inside the parallel passes, so only picking the next bucket (O(threads)) is sequential
+//returns the same distances as dijkstra<G, N, PQ>(g, src), weights can not be negative, threads=0 uses every hardware thread
+template<typename G, typename N>
+std::vector<N>* delta_stepping(const G &g, const uint32_t src, const N delta, const uint32_t threads=0){
+    if(src>=g.getSize()){
+        printErrorMsg(2, "Agrument src in function delta_stepping(const G&, const uint32_t, const N, const uint32_t) is outside of the graph.");
+    }
+    if(!(delta>0)){
+        printErrorMsg(2, "Agrument delta in function delta_stepping(const G&, const uint32_t, const N, const uint32_t) has to be positive.");
+    }
+    const uint32_t size=g.getSize();
+    const N max=g.getMax();
+    ThreadPool pool(threads);
+    const uint32_t thread_count=pool.getSize();
+    std::vector<std::atomic<N>>distance(size);
+    std::vector<std::atomic<uint32_t>>requested(size), removed(size);
+    parallelForBlocks(pool, 0, size, [&](const uint32_t, const uint64_t b, const uint64_t e){
+        for(uint64_t i=b;i<e;++i){
+            distance[i].store(max, std::memory_order_relaxed);
+            requested[i].store(0, std::memory_order_relaxed);
+            removed[i].store(0, std::memory_order_relaxed);
+        }
+    });
+    distance[src].store(0, std::memory_order_relaxed);
+    auto bucketOf=[&delta](const N &d){
+        return (uint64_t)(d/delta);
+    };
+    std::vector<DeltaSteppingBuckets>buckets(thread_count);
+    std::vector<std::vector<uint32_t>>again(thread_count), removed_by(thread_count);
+    std::vector<uint64_t>offsets(thread_count+1);
+    std::vector<uint32_t>current, settled;
+    buckets[0].push(0, 0, src);
+    uint64_t index=0;
+    uint32_t round=0, bucket_round=0;
+
+    //concatenates the lists list(thread_id) into out (every thread copies and clears its own list)
+    auto gather=[&](std::vector<uint32_t> &out, const auto &list){
+        offsets[0]=0;
+        for(uint32_t id=0;id<thread_count;++id) offsets[id+1]=offsets[id]+list(id).size();
+        out.resize(offsets[thread_count]);
+        pool.run([&](const uint32_t id){
+            std::vector<uint32_t> &l=list(id);
+            std::copy(l.begin(), l.end(), out.begin()+offsets[id]);
+            l.clear();
+        });
+    };
+    //lowers the distance of v to d, v goes to again if it stays in the current bucket
+    auto relax=[&](const uint32_t id, const uint32_t v, const N d){
+        if(!atomicMin(distance[v], d)) return;
+        const uint64_t b=bucketOf(d);
+        if(b==index) again[id].push_back(v);
+        else buckets[id].push(index, b, v);
+    };
+
+    while(true){
+        uint64_t pending=0;
+        for(const auto &b : buckets) pending+=b.count;
+        if(pending==0) break;
+        //every stored bucket number is at least index, so the next one is found by moving index up
+        while(true){
+            bool found=false;
+            for(auto &b : buckets) found=found || !b.get(index).empty();
+            if(found) break;
+            ++index;
+        }
+        ++bucket_round;
+        for(auto &b : buckets) b.count-=b.get(index).size();
+        gather(current, [&](const uint32_t id) -> std::vector<uint32_t>& {
+            return buckets[id].get(index);
+        });
+        while(!current.empty()){
+            ++round;
+            parallelForBlocks(pool, 0, current.size(), [&](const uint32_t id, const uint64_t b, const uint64_t e){
+                for(uint64_t i=b;i<e;++i){
+                    const uint32_t v=current[i];
+                    const N d=distance[v].load(std::memory_order_relaxed);
+                    //stale entries (the vertex moved to a lower bucket) and second copies in one round are skipped
+                    if(bucketOf(d)!=index || requested[v].exchange(round, std::memory_order_relaxed)==round) continue;
+                    if(removed[v].load(std::memory_order_relaxed)!=bucket_round){
+                        removed[v].store(bucket_round, std::memory_order_relaxed);
+                        removed_by[id].push_back(v);
+                    }
+                    for(const auto &j : g.getNeighboursWithWeightsRange(v)){
+                        if(j.second<=delta) relax(id, j.first, (N)(d+j.second));
+                    }
+                }
+            });
+            gather(current, [&](const uint32_t id) -> std::vector<uint32_t>& {
+                return again[id];
+            });
+        }
+        gather(settled, [&](const uint32_t id) -> std::vector<uint32_t>& {
+            return removed_by[id];
+        });
+        parallelForBlocks(pool, 0, settled.size(), [&](const uint32_t id, const uint64_t b, const uint64_t e){
+            for(uint64_t i=b;i<e;++i){
+                const N d=distance[settled[i]].load(std::memory_order_relaxed);
+                for(const auto &j : g.getNeighboursWithWeightsRange(settled[i])){
+                    if(j.second>delta) relax(id, j.first, (N)(d+j.second));
+                }
+            }
+        });
+    }
+    auto result=new std::vector<N>(size);
+    for(uint32_t i=0;i<size;++i) (*result)[i]=distance[i].load(std::memory_order_relaxed);
+    return result;
+}
+
 template<typename G, typename N, typename PQ, typename F>
 N dijkstra_with_f(const G &g, const uint32_t src, const uint32_t destination, const F &fun) {
     if(src>=g.getSize()){
@@ -569,7 +1281,7 @@ N dijkstra_with_f(const G &g, const uint32_t src, const uint32_t destination, co
         top=pq.top().first;
         pq.pop();
         is_visited[top]=true;
-        for(auto &i : g.getNeighboursWithWeights(top)) {
+        for(const auto &i : g.getNeighboursWithWeightsRange(top)) {
             if(!is_visited[i.first] && distance[i.first]>distance[top]+i.second && fun(i.first, distance[top]+i.second)) {
                 distance[i.first]=distance[top]+i.second;
                 pq.push(i.first, distance[i.first]);
@@ -603,7 +1315,7 @@ std::vector<uint32_t>* dijkstra_path(const G &g, const uint32_t src, const uint3
         top=pq.top().first;
         pq.pop();
         is_visited[top]=true;
-        for(auto &i : g.getNeighboursWithWeights(top)) {
+        for(const auto &i : g.getNeighboursWithWeightsRange(top)) {
             if(!is_visited[i.first] && distance[i.first]>distance[top]+i.second) {
                 distance[i.first]=distance[top]+i.second;
                 neighbours[i.first]=top;
@@ -648,7 +1360,7 @@ std::vector<uint32_t>* dijkstra_path_with_f(const G &g, const uint32_t src, cons
         top=pq.top().first;
         pq.pop();
         is_visited[top]=true;
-        for(auto &i : g.getNeighboursWithWeights(top)) {
+        for(const auto &i : g.getNeighboursWithWeightsRange(top)) {
             if(!is_visited[i.first] && distance[i.first]>distance[top]+i.second && fun(i.first, distance[top]+i.second)) {
                 distance[i.first]=distance[top]+i.second;
                 neighbours[i.first]=top;
@@ -704,7 +1416,7 @@ std::unordered_map<uint32_t, N>* dijkstra(const G &g, const uint32_t src, const
             result->at(top)=distance[top];
             ++counter;
         }
-        for(auto &i : g.getNeighboursWithWeights(top)) {
+        for(const auto &i : g.getNeighboursWithWeightsRange(top)) {
             if(!is_visited[i.first] && distance[i.first]>distance[top]+i.second) {
                 distance[i.first]=distance[top]+i.second;
                 pq.push(i.first, distance[i.first]);
@@ -746,7 +1458,7 @@ std::unordered_map<uint32_t, N>* dijkstra_with_f(const G &g, const uint32_t src,
             result->at(top)=distance[top];
             ++counter;
         }
-        for(auto &i : g.getNeighboursWithWeights(top)) {
+        for(const auto &i : g.getNeighboursWithWeightsRange(top)) {
             if(!is_visited[i.first] && distance[i.first]>distance[top]+i.second && fun(i.first, result->at(top)+i.second)) {
                 distance[i.first]=distance[top]+i.second;
                 pq.push(i.first, distance[i.first]);
@@ -774,7 +1486,7 @@ std::vector<N>* dijkstra(const G &g, const uint32_t src) {
         top=pq.top().first;
         pq.pop();
         is_visited[top]=true;
-        for(auto &i : g.getNeighboursWithWeights(top)) {
+        for(const auto &i : g.getNeighboursWithWeightsRange(top)) {
             if(!is_visited[i.first] && result->at(i.first)>result->at(top)+i.second) {
                 result->at(i.first)=result->at(top)+i.second;
                 pq.push(i.first, result->at(i.first));
@@ -802,7 +1514,7 @@ std::vector<N>* dijkstra_with_f(const G &g, const uint32_t src, const F &fun) {
         top=pq.top().first;
         pq.pop();
         is_visited[top]=true;
-        for(auto &i : g.getNeighboursWithWeights(top)) {
+        for(const auto &i : g.getNeighboursWithWeightsRange(top)) {
             if(!is_visited[i.first] && result->at(i.first)>result->at(top)+i.second && fun(i.first, result->at(top)+i.second)) {
                 result->at(i.first)=result->at(top)+i.second;
                 pq.push(i.first, result->at(i.first));
@@ -824,7 +1536,7 @@ std::vector<N>* bellmanFord(const G &g, const uint32_t src) {
         bool flag=true;
         for(uint32_t j=0;j<g.getSize();++j) {
             if(result->at(j)!=max) {
-                for(auto k : g.getNeighboursWithWeights(j)) {
+                for(auto k : g.getNeighboursWithWeightsRange(j)) {
                     if(result->at(k.first)>k.second+result->at(j)) {
                         result->at(k.first)=k.second+result->at(j);
                         flag=false;
@@ -837,7 +1549,7 @@ std::vector<N>* bellmanFord(const G &g, const uint32_t src) {
 
     for(uint32_t j=0;j<g.getSize();++j) {
         if(result->at(j)!=max) {
-            for(auto k : g.getNeighboursWithWeights(j)) {
+            for(auto k : g.getNeighboursWithWeightsRange(j)) {
                 if(result->at(k.first)>k.second+result->at(j)) {
                     delete result;
                     return nullptr;
@@ -848,13 +1560,181 @@ std::vector<N>* bellmanFord(const G &g, const uint32_t src) {
     return result;
 }
 
+//looks for a cycle in the graph of parent pointers (parent[v] -> v), stamp is a buffer of parent.size() elements
+//cycle gets the vertexes in the order of edges (cycle[i] -> cycle[i+1] -> ... -> cycle[0])
+inline bool findParentCycle(const std::vector<uint32_t> &parent, std::vector<uint32_t> &stamp, std::vector<uint32_t> &cycle){
+    const uint32_t size=parent.size();
+    std::fill(stamp.begin(), stamp.end(), UINT32_MAX);
+    for(uint32_t i=0;i<size;++i){
+        uint32_t v=i;
+        while(v!=UINT32_MAX && stamp[v]==UINT32_MAX){
+            stamp[v]=i;
+            v=parent[v];
+        }
+        if(v==UINT32_MAX || stamp[v]!=i) continue;
+        cycle.clear();
+        uint32_t u=v;
+        do{
+            cycle.push_back(u);
+            u=parent[u];
+        }while(u!=v);
+        std::reverse(cycle.begin(), cycle.end());
+        return true;
+    }
+    return false;
+}
+
+//true if the cycle (in the order of edges) is negative when the lightest edge between every two consecutive vertexes is taken
+template<typename G, typename N>
+bool isNegativeCycle(const G &g, const std::vector<uint32_t> &cycle){
+    N sum=0;
+    for(uint32_t i=0;i<cycle.size();++i){
+        const uint32_t next=cycle[i+1==cycle.size() ? 0 : i+1];
+        bool found=false;
+        N lightest=0;
+        for(const auto &j : g.getNeighboursWithWeightsRange(cycle[i])){
+            if(j.first==next && (!found || j.second<lightest)){
+                lightest=j.second;
+                found=true;
+            }
+        }
+        if(!found) return false;
+        sum+=lightest;
+    }
+    return sum<0;
+}
+
+//queue-based Bellman-Ford (SPFA): only vertexes whose distance changed are relaxed again, each vertex is in the queue at most once
+//returns nullptr if a negative cycle is reachable from src, negative_cycle (if given) then gets the vertexes of one such cycle
+//the graph of parent pointers has a cycle only if the graph has a negative one, it is searched after every size relaxations
+template<typename G, typename N>
+std::vector<N>* spfa(const G &g, const uint32_t src, std::vector<uint32_t> *negative_cycle=nullptr){
+    if(src>=g.getSize()){
+        printErrorMsg(2, "Agrument src in function spfa(const G&, const uint32_t, std::vector<uint32_t>*) is outside of the graph.");
+    }
+    const uint32_t size=g.getSize();
+    const N max=g.getMax();
+    auto result=new std::vector<N>(size, max);
+    std::vector<N> &distance=*result;
+    std::vector<uint32_t>parent(size, UINT32_MAX), queue(size), stamp(size), cycle;
+    std::vector<bool>in_queue(size, false);
+    uint32_t head=0, count=1, relaxations=0;
+    queue[0]=src;
+    in_queue[src]=true;
+    distance[src]=0;
+
+    while(count){
+        const uint32_t u=queue[head];
+        head=head+1==size ? 0 : head+1;
+        --count;
+        in_queue[u]=false;
+        const N d=distance[u];
+        for(const auto &j : g.getNeighboursWithWeightsRange(u)){
+            if(d+j.second<distance[j.first]){
+                distance[j.first]=d+j.second;
+                parent[j.first]=u;
+                if(!in_queue[j.first]){
+                    in_queue[j.first]=true;
+                    queue[head+count<size ? head+count : head+count-size]=j.first;
+                    ++count;
+                }
+                if(++relaxations==size){
+                    relaxations=0;
+                    if(findParentCycle(parent, stamp, cycle)){
+                        if(negative_cycle) negative_cycle->swap(cycle);
+                        delete result;
+                        return nullptr;
+                    }
+                }
+            }
+        }
+    }
+    return result;
+}
+
+//frontier-parallel Bellman-Ford: in every round the vertexes whose distance dropped in the previous round relax their edges in parallel,
+//distances are lowered atomically; a negative cycle is reported when a cycle of parent pointers turns out to be negative
+//or when the frontier is not empty after size rounds, returns nullptr then and fills negative_cycle (if given)
+//threads=0 uses every hardware thread
+template<typename G, typename N>
+std::vector<N>* parallel_bellman_ford(const G &g, const uint32_t src, const uint32_t threads=0, std::vector<uint32_t> *negative_cycle=nullptr){
+    if(src>=g.getSize()){
+        printErrorMsg(2, "Agrument src in function parallel_bellman_ford(const G&, const uint32_t, const uint32_t, std::vector<uint32_t>*) is outside of the graph.");
+    }
+    const uint32_t size=g.getSize();
+    const N max=g.getMax();
+    ThreadPool pool(threads);
+    std::vector<std::atomic<N>>distance(size);
+    std::vector<std::atomic<uint32_t>>parent(size), claimed(size);
+    parallelForBlocks(pool, 0, size, [&](const uint32_t, const uint64_t b, const uint64_t e){
+        for(uint64_t i=b;i<e;++i){
+            distance[i].store(max, std::memory_order_relaxed);
+            parent[i].store(UINT32_MAX, std::memory_order_relaxed);
+            claimed[i].store(UINT32_MAX, std::memory_order_relaxed);
+        }
+    });
+    distance[src].store(0, std::memory_order_relaxed);
+    std::vector<std::vector<uint32_t>>next;
+    std::vector<uint64_t>offsets;
+    std::vector<uint32_t>frontier(1, src), following, parent_copy, stamp, cycle;
+    uint64_t relaxed_since_check=0;
+    for(uint32_t round=0;!frontier.empty();++round){
+        if(round==size){
+            if(negative_cycle){
+                auto tmp=spfa<G, N>(g, src, negative_cycle);
+                delete tmp;
+            }
+            return nullptr;
+        }
+        //parents are written after the distances without synchronisation, so a cycle found among them is verified
+        relaxed_since_check+=frontier.size();
+        if(relaxed_since_check>=size){
+            relaxed_since_check=0;
+            parent_copy.resize(size);
+            stamp.resize(size);
+            for(uint32_t i=0;i<size;++i) parent_copy[i]=parent[i].load(std::memory_order_relaxed);
+            if(findParentCycle(parent_copy, stamp, cycle) && isNegativeCycle<G, N>(g, cycle)){
+                if(negative_cycle) negative_cycle->swap(cycle);
+                return nullptr;
+            }
+        }
+        //chunks of the frontier are handed out dynamically and every chunk collects the next frontier in its own slot
+        const uint64_t chunk=frontierChunkSize(frontier.size(), pool.getSize());
+        const uint64_t chunks=(frontier.size()+chunk-1)/chunk;
+        if(next.size()<chunks) next.resize(chunks);
+        offsets.assign(chunks+1, 0);
+        parallelForChunks(pool, 0, frontier.size(), chunk, [&](const uint64_t c, const uint64_t b, const uint64_t e){
+            for(uint64_t i=b;i<e;++i){
+                const N d=distance[frontier[i]].load(std::memory_order_relaxed);
+                for(const auto &j : g.getNeighboursWithWeightsRange(frontier[i])){
+                    if(atomicMin(distance[j.first], (N)(d+j.second))){
+                        parent[j.first].store(frontier[i], std::memory_order_relaxed);
+                        if(claimed[j.first].exchange(round, std::memory_order_relaxed)!=round) next[c].push_back(j.first);
+                    }
+                }
+            }
+            offsets[c+1]=next[c].size();
+        });
+        for(uint64_t c=0;c<chunks;++c) offsets[c+1]+=offsets[c];
+        following.resize(offsets[chunks]);
+        parallelForChunks(pool, 0, chunks, 1, [&](const uint64_t c, const uint64_t, const uint64_t){
+            std::copy(next[c].begin(), next[c].end(), following.begin()+offsets[c]);
+            next[c].clear();
+        });
+        frontier.swap(following);
+    }
+    auto result=new std::vector<N>(size);
+    for(uint32_t i=0;i<size;++i) (*result)[i]=distance[i].load(std::memory_order_relaxed);
+    return result;
+}
+
 template<typename G, typename N>
 std::vector<std::vector<N>>* floydWarshall(const G &g){
     N max=g.getMax();
     std::vector<std::vector<N>>* result=new std::vector<std::vector<N>>(g.getSize(), std::vector<N>(g.getSize(), max));
 
     for(uint32_t i=0;i<g.getSize();++i) {
-        for(auto j : g.getNeighboursWithWeights(i)){
+        for(auto j : g.getNeighboursWithWeightsRange(i)){
             if(i==j.first && j.second<0){
                 delete result;
                 return nullptr;
@@ -882,6 +1762,163 @@ std::vector<std::vector<N>>* floydWarshall(const G &g){
     return result;
 }
 
+#define FLOYD_WARSHALL_BLOCK 64
+
+//row[j]=min(row[j], value+k_row[j]) for one row of a tile, k_row[j]==max is treated as infinity
+//the length is fixed, so the loop has no remainder and the compiler turns it into vector min/blend instructions
+template<typename N>
+inline void floydWarshallRow(N *row, const N *k_row, const N value, const N max){
+    N tmp[FLOYD_WARSHALL_BLOCK];
+    for(uint32_t j=0;j<FLOYD_WARSHALL_BLOCK;++j){
+        tmp[j]=k_row[j]==max ? max : (N)(value+k_row[j]);
+    }
+    for(uint32_t j=0;j<FLOYD_WARSHALL_BLOCK;++j){
+        row[j]=tmp[j]<row[j] ? tmp[j] : row[j];
+    }
+}
+
+//relaxes tile (ib, jb) through the vertexes of block kb, rows of a tile end at size, columns always span a whole block
+template<typename N>
+void floydWarshallTile(DenseMatrix<N> &d, const uint32_t ib, const uint32_t jb, const uint32_t kb, const uint32_t size, const N max){
+    const uint32_t i_end=std::min(ib+FLOYD_WARSHALL_BLOCK, size);
+    const uint32_t k_end=std::min(kb+FLOYD_WARSHALL_BLOCK, size);
+    if(ib!=kb){
+        //rows of block kb do not change here, so every row of the tile can go through all k at once
+        for(uint32_t i=ib;i<i_end;++i){
+            N *row=d.getRow(i)+jb;
+            for(uint32_t k=kb;k<k_end;++k){
+                const N value=d.at(i, k);
+                if(value!=max) floydWarshallRow(row, d.getRow(k)+jb, value, max);
+            }
+        }
+        return;
+    }
+    for(uint32_t k=kb;k<k_end;++k){
+        const N *k_row=d.getRow(k)+jb;
+        for(uint32_t i=ib;i<i_end;++i){
+            const N value=d.at(i, k);
+            if(i!=k && value!=max) floydWarshallRow(d.getRow(i)+jb, k_row, value, max);
+        }
+    }
+}
+
+//blocked Floyd-Warshall on one padded matrix: for every block kb the diagonal tile is computed first, then the tiles
+//in row and column kb, then all the other tiles, tiles of the last two phases are spread over threads
+//returns nullptr if there is a negative cycle, threads=0 uses every hardware thread
+template<typename G, typename N>
+DenseMatrix<N>* parallel_floyd_warshall(const G &g, const uint32_t threads=0){
+    const uint32_t size=g.getSize();
+    const N max=g.getMax();
+    const uint32_t blocks=(size+FLOYD_WARSHALL_BLOCK-1)/FLOYD_WARSHALL_BLOCK;
+    auto result=new DenseMatrix<N>(size, max, blocks*FLOYD_WARSHALL_BLOCK);
+    for(uint32_t i=0;i<size;++i){
+        for(const auto &j : g.getNeighboursWithWeightsRange(i)){
+            if(j.second<result->at(i, j.first)) result->at(i, j.first)=j.second;
+        }
+        if(result->at(i, i)<0){
+            delete result;
+            return nullptr;
+        }
+        result->at(i, i)=0;
+    }
+
+    ThreadPool pool(threads);
+    std::atomic<uint32_t>next;
+    for(uint32_t b=0;b<blocks;++b){
+        const uint32_t kb=b*FLOYD_WARSHALL_BLOCK;
+        floydWarshallTile(*result, kb, kb, kb, size, max);
+        next.store(0, std::memory_order_relaxed);
+        pool.run([&](const uint32_t){
+            for(uint32_t t=next.fetch_add(1, std::memory_order_relaxed);t<2*blocks;t=next.fetch_add(1, std::memory_order_relaxed)){
+                const uint32_t other=(t>>1)*FLOYD_WARSHALL_BLOCK;
+                if(other==kb) continue;
+                if(t&1) floydWarshallTile(*result, other, kb, kb, size, max);
+                else floydWarshallTile(*result, kb, other, kb, size, max);
+            }
+        });
+        next.store(0, std::memory_order_relaxed);
+        pool.run([&](const uint32_t){
+            for(uint32_t t=next.fetch_add(1, std::memory_order_relaxed);t<blocks;t=next.fetch_add(1, std::memory_order_relaxed)){
+                const uint32_t ib=t*FLOYD_WARSHALL_BLOCK;
+                if(ib==kb) continue;
+                for(uint32_t jb=0;jb<blocks*FLOYD_WARSHALL_BLOCK;jb+=FLOYD_WARSHALL_BLOCK){
+                    if(jb!=kb) floydWarshallTile(*result, ib, jb, kb, size, max);
+                }
+            }
+        });
+    }
+
+    for(uint32_t i=0;i<size;++i){
+        if(result->at(i, i)<0){
+            delete result;
+            return nullptr;
+        }
+    }
+    return result;
+}
+
+//Johnson's algorithm: Bellman-Ford from a virtual vertex joined to every vertex gives potentials h, which make every weight
+//w(u, v)+h[u]-h[v] non-negative, then Dijkstra (with any PQ) runs from every source in parallel
+//rows are not gathered into a matrix, sink(src, distances) is called once per source (never by two threads at once),
+//distances[v] is getMax() if v can not be reached; returns false (without calling sink) if there is a negative cycle
+template<typename G, typename N, typename PQ, typename F>
+bool johnson(const G &g, const F &sink, const uint32_t threads=0){
+    const uint32_t size=g.getSize();
+    if(size==0) return true;
+    const N max=g.getMax();
+    std::vector<N>h(size, 0);
+    bool changed=true;
+    for(uint32_t i=0;i<size && changed;++i){
+        changed=false;
+        for(uint32_t u=0;u<size;++u){
+            for(const auto &j : g.getNeighboursWithWeightsRange(u)){
+                if(h[j.first]>h[u]+j.second){
+                    h[j.first]=h[u]+j.second;
+                    changed=true;
+                }
+            }
+        }
+    }
+    if(changed) return false;
+
+    ThreadPool pool(threads);
+    std::atomic<uint32_t>next(0);
+    std::mutex sink_mutex;
+    pool.run([&](const uint32_t){
+        std::vector<N>distance(size), result(size);
+        std::vector<bool>is_visited(size);
+        PQ pq(size);
+        for(uint32_t src=next.fetch_add(1, std::memory_order_relaxed);src<size;src=next.fetch_add(1, std::memory_order_relaxed)){
+            std::fill(distance.begin(), distance.end(), max);
+            std::fill(is_visited.begin(), is_visited.end(), false);
+            pq.clear();
+            pq.push(src, 0);
+            distance[src]=0;
+            while(!pq.empty()){
+                const uint32_t top=pq.top().first;
+                pq.pop();
+                is_visited[top]=true;
+                for(const auto &j : g.getNeighboursWithWeightsRange(top)){
+                    if(is_visited[j.first]) continue;
+                    N weight=j.second+h[top]-h[j.first];
+                    //rounding of floating point potentials can leave a tiny negative value
+                    if(std::is_signed<N>::value && weight<0) weight=0;
+                    if(distance[j.first]>distance[top]+weight){
+                        distance[j.first]=distance[top]+weight;
+                        pq.push(j.first, distance[j.first]);
+                    }
+                }
+            }
+            for(uint32_t v=0;v<size;++v){
+                result[v]=distance[v]==max ? max : (N)(distance[v]-h[src]+h[v]);
+            }
+            std::lock_guard<std::mutex>lock(sink_mutex);
+            sink(src, (const std::vector<N>&)result);
+        }
+    });
+    return true;
+}
+
 template<typename G, typename N, typename PQ, typename H>
 N A_star(const G &g, const uint32_t src, const uint32_t destination, const H &heuristic) {
     if(src>=g.getSize()){
@@ -903,7 +1940,7 @@ N A_star(const G &g, const uint32_t src, const uint32_t destination, const H &he
         top=pq.top().first;
         pq.pop();
         is_visited[top]=true;
-        for(auto &i : g.getNeighboursWithWeights(top)) {
+        for(const auto &i : g.getNeighboursWithWeightsRange(top)) {
             if(!is_visited[i.first] && distance[i.first]>distance[top]+i.second){
                 pq.push(i.first, distance[top]+i.second+heuristic(i.first));
                 distance[i.first]=distance[top]+i.second;
@@ -937,7 +1974,7 @@ std::vector<uint32_t>* A_star_path(const G &g, const uint32_t src, const uint32_
         top=pq.top().first;
         pq.pop();
         is_visited[top]=true;
-        for(auto &i : g.getNeighboursWithWeights(top)) {
+        for(const auto &i : g.getNeighboursWithWeightsRange(top)) {
             if(!is_visited[i.first] && distance[i.first]>distance[top]+i.second){
                 pq.push(i.first, distance[top]+i.second+heuristic(i.first));
                 distance[i.first]=distance[top]+i.second;
@@ -960,4 +1997,225 @@ std::vector<uint32_t>* A_star_path(const G &g, const uint32_t src, const uint32_
     return path;
 }
 
+//checks that ws can hold every vertex of g and that src and every destination are in g, name is the name of the calling function
+template<typename G, typename N, typename PQ>
+void checkWorkspace(const G &g, const uint32_t src, const uint32_t *destinations, const size_t count, const SearchWorkspace<N, PQ> &ws, const char *name){
+    if(ws.getSize()<g.getSize()){
+        printErrorMsg(2, (std::string("Workspace passed to function ")+name+" is smaller than the graph.").c_str());
+    }
+    if(src>=g.getSize()){
+        printErrorMsg(2, (std::string("Agrument src in function ")+name+" is outside of the graph.").c_str());
+    }
+    for(size_t i=0;i<count;++i){
+        if(destinations[i]>=g.getSize()){
+            printErrorMsg(2, (std::string("Agrument destination in function ")+name+" is outside of the graph.").c_str());
+        }
+    }
+}
+
+//resets ws and marks the destinations, returns the number of different destinations (0 - the search never stops early)
+template<typename N, typename PQ>
+size_t markDestinations(const uint32_t *destinations, const size_t count, SearchWorkspace<N, PQ> &ws){
+    ws.reset();
+    size_t targets=0;
+    for(size_t i=0;i<count;++i){
+        if(!ws.isMarked(destinations[i])){
+            ws.mark(destinations[i]);
+            ++targets;
+        }
+    }
+    return targets;
+}
+
+//bfs on the buffers of ws, stops when every destination is reached (count=0 - never), fun(vertex, distance) as in bfs_with_f
+template<typename G, typename PQ, typename F>
+void workspaceBfs(const G &g, const uint32_t src, const uint32_t *destinations, const size_t count, SearchWorkspace<int32_t, PQ> &ws, const F &fun){
+    size_t targets=markDestinations(destinations, count, ws);
+    std::vector<uint32_t> &queue=ws.getVertexQueue();
+    ws.reach(src, 0, UINT32_MAX);
+    if(targets && ws.isMarked(src) && --targets==0) return;
+    queue.push_back(src);
+    for(size_t head=0;head<queue.size();++head){
+        const uint32_t u=queue[head];
+        const int32_t d=ws.getDistance(u)+1;
+        for(uint32_t i : g.getNeighboursRange(u)){
+            if(!ws.isReached(i) && fun(i, d)){
+                ws.reach(i, d, u);
+                if(targets && ws.isMarked(i) && --targets==0) return;
+                queue.push_back(i);
+            }
+        }
+    }
+}
+
+//Dijkstra (A* for a non-zero heuristic) on the buffers of ws, stops when every destination is settled (count=0 - never)
+//fun(vertex, distance) can reject a relaxation as in dijkstra_with_f
+template<typename G, typename N, typename PQ, typename F, typename H>
+void workspaceDijkstra(const G &g, const uint32_t src, const uint32_t *destinations, const size_t count, SearchWorkspace<N, PQ> &ws,
+                       const F &fun, const H &heuristic){
+    size_t targets=markDestinations(destinations, count, ws);
+    PQ &pq=ws.getQueue();
+    ws.reach(src, 0, UINT32_MAX);
+    pq.push(src, heuristic(src));
+    while(!pq.empty()){
+        const uint32_t top=pq.top().first;
+        pq.pop();
+        ws.settle(top);
+        if(targets && ws.isMarked(top) && --targets==0) return;
+        const N d=ws.getDistance(top);
+        for(const auto &i : g.getNeighboursWithWeightsRange(top)){
+            const N candidate=d+i.second;
+            if(!ws.isSettled(i.first) && (!ws.isReached(i.first) || candidate<ws.getDistance(i.first)) && fun(i.first, candidate)){
+                ws.reach(i.first, candidate, top);
+                pq.push(i.first, candidate+heuristic(i.first));
+            }
+        }
+    }
+}
+
+//the functions below work like the ones without a workspace, but take every buffer from ws (see SearchWorkspace)
+//and allocate nothing once ws has warmed up; after a call ws also holds the distances and parents of the search
+//distances from src to every vertex are left in ws (ws.isReached(v), ws.getDistance(v))
+template<typename G, typename PQ>
+void bfs(const G &g, const uint32_t src, SearchWorkspace<int32_t, PQ> &ws){
+    checkWorkspace(g, src, nullptr, 0, ws, "bfs(const G&, const uint32_t, SearchWorkspace&)");
+    workspaceBfs(g, src, nullptr, 0, ws, [](const uint32_t, const int32_t){return true;});
+}
+
+template<typename G, typename PQ, typename F>
+void bfs_with_f(const G &g, const uint32_t src, const F &fun, SearchWorkspace<int32_t, PQ> &ws){
+    checkWorkspace(g, src, nullptr, 0, ws, "bfs_with_f(const G&, const uint32_t, const F&, SearchWorkspace&)");
+    workspaceBfs(g, src, nullptr, 0, ws, fun);
+}
+
+//the search stops when every destination is reached, their distances are left in ws
+template<typename G, typename PQ>
+void bfs(const G &g, const uint32_t src, const std::vector<uint32_t> &destinations, SearchWorkspace<int32_t, PQ> &ws){
+    checkWorkspace(g, src, destinations.data(), destinations.size(), ws, "bfs(const G&, const uint32_t, const std::vector<uint32_t>&, SearchWorkspace&)");
+    if(destinations.empty()){
+        ws.reset();
+        return;
+    }
+    workspaceBfs(g, src, destinations.data(), destinations.size(), ws, [](const uint32_t, const int32_t){return true;});
+}
+
+template<typename G, typename PQ, typename F>
+void bfs_with_f(const G &g, const uint32_t src, const std::vector<uint32_t> &destinations, const F &fun, SearchWorkspace<int32_t, PQ> &ws){
+    checkWorkspace(g, src, destinations.data(), destinations.size(), ws, "bfs_with_f(const G&, const uint32_t, const std::vector<uint32_t>&, const F&, SearchWorkspace&)");
+    if(destinations.empty()){
+        ws.reset();
+        return;
+    }
+    workspaceBfs(g, src, destinations.data(), destinations.size(), ws, fun);
+}
+
+template<typename G, typename PQ>
+int32_t bfs(const G &g, const uint32_t src, const uint32_t destination, SearchWorkspace<int32_t, PQ> &ws){
+    checkWorkspace(g, src, &destination, 1, ws, "bfs(const G&, const uint32_t, const uint32_t, SearchWorkspace&)");
+    workspaceBfs(g, src, &destination, 1, ws, [](const uint32_t, const int32_t){return true;});
+    return ws.isReached(destination) ? ws.getDistance(destination) : -1;
+}
+
+template<typename G, typename PQ, typename F>
+int32_t bfs_with_f(const G &g, const uint32_t src, const uint32_t destination, const F &fun, SearchWorkspace<int32_t, PQ> &ws){
+    checkWorkspace(g, src, &destination, 1, ws, "bfs_with_f(const G&, const uint32_t, const uint32_t, const F&, SearchWorkspace&)");
+    workspaceBfs(g, src, &destination, 1, ws, fun);
+    return ws.isReached(destination) ? ws.getDistance(destination) : -1;
+}
+
+//returns false if there is no path, path is overwritten
+template<typename G, typename PQ>
+bool bfs_path(const G &g, const uint32_t src, const uint32_t destination, SearchWorkspace<int32_t, PQ> &ws, std::vector<uint32_t> &path){
+    checkWorkspace(g, src, &destination, 1, ws, "bfs_path(const G&, const uint32_t, const uint32_t, SearchWorkspace&, std::vector<uint32_t>&)");
+    workspaceBfs(g, src, &destination, 1, ws, [](const uint32_t, const int32_t){return true;});
+    return ws.getPath(destination, path);
+}
+
+template<typename G, typename PQ, typename F>
+bool bfs_path_with_f(const G &g, const uint32_t src, const uint32_t destination, const F &fun, SearchWorkspace<int32_t, PQ> &ws, std::vector<uint32_t> &path){
+    checkWorkspace(g, src, &destination, 1, ws, "bfs_path_with_f(const G&, const uint32_t, const uint32_t, const F&, SearchWorkspace&, std::vector<uint32_t>&)");
+    workspaceBfs(g, src, &destination, 1, ws, fun);
+    return ws.getPath(destination, path);
+}
+
+//distances from src to every vertex are left in ws (ws.isReached(v), ws.getDistance(v))
+template<typename G, typename N, typename PQ>
+void dijkstra(const G &g, const uint32_t src, SearchWorkspace<N, PQ> &ws){
+    checkWorkspace(g, src, nullptr, 0, ws, "dijkstra(const G&, const uint32_t, SearchWorkspace&)");
+    workspaceDijkstra(g, src, nullptr, 0, ws, [](const uint32_t, const N&){return true;}, [](const uint32_t){return N(0);});
+}
+
+template<typename G, typename N, typename PQ, typename F>
+void dijkstra_with_f(const G &g, const uint32_t src, const F &fun, SearchWorkspace<N, PQ> &ws){
+    checkWorkspace(g, src, nullptr, 0, ws, "dijkstra_with_f(const G&, const uint32_t, const F&, SearchWorkspace&)");
+    workspaceDijkstra(g, src, nullptr, 0, ws, fun, [](const uint32_t){return N(0);});
+}
+
+//the search stops when every destination is settled, their distances are left in ws (ws.isSettled(v), ws.getDistance(v))
+template<typename G, typename N, typename PQ>
+void dijkstra(const G &g, const uint32_t src, const std::vector<uint32_t> &destinations, SearchWorkspace<N, PQ> &ws){
+    checkWorkspace(g, src, destinations.data(), destinations.size(), ws, "dijkstra(const G&, const uint32_t, const std::vector<uint32_t>&, SearchWorkspace&)");
+    if(destinations.empty()){
+        ws.reset();
+        return;
+    }
+    workspaceDijkstra(g, src, destinations.data(), destinations.size(), ws, [](const uint32_t, const N&){return true;}, [](const uint32_t){return N(0);});
+}
+
+template<typename G, typename N, typename PQ, typename F>
+void dijkstra_with_f(const G &g, const uint32_t src, const std::vector<uint32_t> &destinations, const F &fun, SearchWorkspace<N, PQ> &ws){
+    checkWorkspace(g, src, destinations.data(), destinations.size(), ws, "dijkstra_with_f(const G&, const uint32_t, const std::vector<uint32_t>&, const F&, SearchWorkspace&)");
+    if(destinations.empty()){
+        ws.reset();
+        return;
+    }
+    workspaceDijkstra(g, src, destinations.data(), destinations.size(), ws, fun, [](const uint32_t){return N(0);});
+}
+
+template<typename G, typename N, typename PQ>
+N dijkstra(const G &g, const uint32_t src, const uint32_t destination, SearchWorkspace<N, PQ> &ws){
+    checkWorkspace(g, src, &destination, 1, ws, "dijkstra(const G&, const uint32_t, const uint32_t, SearchWorkspace&)");
+    workspaceDijkstra(g, src, &destination, 1, ws, [](const uint32_t, const N&){return true;}, [](const uint32_t){return N(0);});
+    return ws.isSettled(destination) ? ws.getDistance(destination) : g.getMax();
+}
+
+template<typename G, typename N, typename PQ, typename F>
+N dijkstra_with_f(const G &g, const uint32_t src, const uint32_t destination, const F &fun, SearchWorkspace<N, PQ> &ws){
+    checkWorkspace(g, src, &destination, 1, ws, "dijkstra_with_f(const G&, const uint32_t, const uint32_t, const F&, SearchWorkspace&)");
+    workspaceDijkstra(g, src, &destination, 1, ws, fun, [](const uint32_t){return N(0);});
+    return ws.isSettled(destination) ? ws.getDistance(destination) : g.getMax();
+}
+
+//returns false if there is no path, path is overwritten
+template<typename G, typename N, typename PQ>
+bool dijkstra_path(const G &g, const uint32_t src, const uint32_t destination, SearchWorkspace<N, PQ> &ws, std::vector<uint32_t> &path){
+    checkWorkspace(g, src, &destination, 1, ws, "dijkstra_path(const G&, const uint32_t, const uint32_t, SearchWorkspace&, std::vector<uint32_t>&)");
+    workspaceDijkstra(g, src, &destination, 1, ws, [](const uint32_t, const N&){return true;}, [](const uint32_t){return N(0);});
+    path.clear();
+    return ws.isSettled(destination) && ws.getPath(destination, path);
+}
+
+template<typename G, typename N, typename PQ, typename F>
+bool dijkstra_path_with_f(const G &g, const uint32_t src, const uint32_t destination, const F &fun, SearchWorkspace<N, PQ> &ws, std::vector<uint32_t> &path){
+    checkWorkspace(g, src, &destination, 1, ws, "dijkstra_path_with_f(const G&, const uint32_t, const uint32_t, const F&, SearchWorkspace&, std::vector<uint32_t>&)");
+    workspaceDijkstra(g, src, &destination, 1, ws, fun, [](const uint32_t){return N(0);});
+    path.clear();
+    return ws.isSettled(destination) && ws.getPath(destination, path);
+}
+
+template<typename G, typename N, typename PQ, typename H>
+N A_star(const G &g, const uint32_t src, const uint32_t destination, const H &heuristic, SearchWorkspace<N, PQ> &ws){
+    checkWorkspace(g, src, &destination, 1, ws, "A_star(const G&, const uint32_t, const uint32_t, const H&, SearchWorkspace&)");
+    workspaceDijkstra(g, src, &destination, 1, ws, [](const uint32_t, const N&){return true;}, heuristic);
+    return ws.isSettled(destination) ? ws.getDistance(destination) : g.getMax();
+}
+
+template<typename G, typename N, typename PQ, typename H>
+bool A_star_path(const G &g, const uint32_t src, const uint32_t destination, const H &heuristic, SearchWorkspace<N, PQ> &ws, std::vector<uint32_t> &path){
+    checkWorkspace(g, src, &destination, 1, ws, "A_star_path(const G&, const uint32_t, const uint32_t, const H&, SearchWorkspace&, std::vector<uint32_t>&)");
+    workspaceDijkstra(g, src, &destination, 1, ws, [](const uint32_t, const N&){return true;}, heuristic);
+    path.clear();
+    return ws.isSettled(destination) && ws.getPath(destination, path);
+}
+
 #endif
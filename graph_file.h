@@ -0,0 +1,290 @@
+#ifndef GRAPH_FILE_H
+#define GRAPH_FILE_H
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include "csr_graph.h"
+#include "adjacency_lists.h"
+#include "error_info.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define GRAPH_FILE_MMAP
+#endif
+
+#define GRAPH_FILE_MAGIC "GLCSRBIN"
+#define GRAPH_FILE_VERSION 1
+#define GRAPH_FILE_ALIGNMENT 64
+#define GRAPH_FILE_DIRECTED 1
+#define GRAPH_FILE_WEIGHTED 2
+#define GRAPH_FILE_MAX_SIZE 32
+
+//layout of a file: header, offsets (uint64_t), targets (uint32_t) and weights (N), every section starts at a multiple of 64 bytes
+//numbers are stored in the byte order of the machine that wrote the file
+struct GraphFileHeader{
+    char magic[8];
+    uint32_t version;
+    uint32_t flags;
+    uint32_t weight_size;
+    uint32_t weight_kind;
+    uint32_t size;
+    uint32_t reserved;
+    uint64_t number_of_edges;
+    uint64_t entries;
+    uint64_t offsets_position;
+    uint64_t targets_position;
+    uint64_t weights_position;
+    uint64_t file_size;
+    unsigned char max[GRAPH_FILE_MAX_SIZE];
+};
+
+//read-only view of a whole file, mapped into memory where mmap is available and read otherwise
+class MappedFile{
+private:
+    const void *data;
+    uint64_t length;
+    bool is_mapped;
+public:
+    explicit MappedFile(const char *path){
+        this->data=nullptr;
+        this->length=0;
+        this->is_mapped=false;
+#ifdef GRAPH_FILE_MMAP
+        int fd=open(path, O_RDONLY);
+        if(fd<0) return;
+        struct stat info;
+        if(fstat(fd, &info)==0 && info.st_size>0){
+            void *ptr=mmap(nullptr, info.st_size, PROT_READ, MAP_SHARED, fd, 0);
+            if(ptr!=MAP_FAILED){
+                this->data=ptr;
+                this->length=info.st_size;
+                this->is_mapped=true;
+            }
+        }
+        close(fd);
+#else
+        std::ifstream in(path, std::ios::binary|std::ios::ate);
+        if(!in) return;
+        const uint64_t len=in.tellg();
+        if(len==0) return;
+        char *buffer=(char*)::operator new[](len, std::align_val_t(GRAPH_FILE_ALIGNMENT));
+        in.seekg(0);
+        if(!in.read(buffer, len)){
+            ::operator delete[](buffer, std::align_val_t(GRAPH_FILE_ALIGNMENT));
+            return;
+        }
+        this->data=buffer;
+        this->length=len;
+#endif
+    }
+
+    MappedFile(const MappedFile&)=delete;
+    MappedFile& operator=(const MappedFile&)=delete;
+
+    ~MappedFile(){
+        this->release();
+    }
+
+    //unmaps (or frees) the file before the object is destroyed, isOpen() returns false afterwards
+    void release(){
+        if(!this->data) return;
+#ifdef GRAPH_FILE_MMAP
+        munmap((void*)this->data, this->length);
+#else
+        ::operator delete[]((void*)this->data, std::align_val_t(GRAPH_FILE_ALIGNMENT));
+#endif
+        this->data=nullptr;
+        this->length=0;
+        this->is_mapped=false;
+    }
+
+    bool isOpen() const{
+        return this->data!=nullptr;
+    }
+
+    //true if the file is shared with the page cache instead of being copied into memory
+    bool isMapped() const{
+        return this->is_mapped;
+    }
+
+    const void *getData() const{
+        return this->data;
+    }
+
+    uint64_t getLength() const{
+        return this->length;
+    }
+};
+
+//weight_kind stored in the header: 0 - no weights, 1 - unsigned integer, 2 - signed integer, 3 - floating point, 4 - other
+template<typename N>
+uint32_t graphFileWeightKind(){
+    if constexpr(std::is_same<N, NoWeight>::value) return 0;
+    else if constexpr(std::is_floating_point<N>::value) return 3;
+    else if constexpr(std::is_integral<N>::value) return std::is_signed<N>::value ? 2 : 1;
+    else return 4;
+}
+
+template<typename G>
+struct GraphFileType;
+
+template<>
+struct GraphFileType<CSRGraph>{
+    typedef NoWeight weight;
+    static const bool directed=false;
+};
+
+template<>
+struct GraphFileType<CSRGraphDirected>{
+    typedef NoWeight weight;
+    static const bool directed=true;
+};
+
+template<typename N>
+struct GraphFileType<CSRGraphWeighted<N>>{
+    typedef N weight;
+    static const bool directed=false;
+};
+
+template<typename N>
+struct GraphFileType<CSRGraphWeightedAndDirected<N>>{
+    typedef N weight;
+    static const bool directed=true;
+};
+
+inline uint64_t graphFileAlign(const uint64_t position){
+    return (position+GRAPH_FILE_ALIGNMENT-1)/GRAPH_FILE_ALIGNMENT*GRAPH_FILE_ALIGNMENT;
+}
+
+inline bool graphFileWritePadding(std::ofstream &out, const uint64_t position){
+    static const char zeros[GRAPH_FILE_ALIGNMENT]={};
+    const uint64_t current=out.tellp();
+    if(current>position) return false;
+    out.write(zeros, position-current);
+    return (bool)out;
+}
+
+//G has to be one of the CSR graphs, other graphs can be saved after converting them (e.g. saveBinaryGraph(CSRGraph(g), path))
+template<typename G>
+bool saveBinaryGraph(const G &g, const char *path){
+    typedef typename GraphFileType<G>::weight N;
+    static_assert(std::is_trivially_copyable<N>::value, "Weights saved in a binary file have to be trivially copyable.");
+    const bool weighted=!std::is_same<N, NoWeight>::value;
+    GraphFileHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, GRAPH_FILE_MAGIC, 8);
+    header.version=GRAPH_FILE_VERSION;
+    header.flags=(GraphFileType<G>::directed ? GRAPH_FILE_DIRECTED : 0)|(weighted ? GRAPH_FILE_WEIGHTED : 0);
+    header.weight_size=weighted ? sizeof(N) : 0;
+    header.weight_kind=graphFileWeightKind<N>();
+    header.size=g.getSize();
+    header.number_of_edges=g.getNumberOfEdges();
+    header.entries=g.getOffsets()[g.getSize()];
+    header.offsets_position=graphFileAlign(sizeof(GraphFileHeader));
+    header.targets_position=graphFileAlign(header.offsets_position+((uint64_t)header.size+1)*sizeof(uint64_t));
+    header.weights_position=graphFileAlign(header.targets_position+header.entries*sizeof(uint32_t));
+    header.file_size=header.weights_position+(weighted ? header.entries*sizeof(N) : 0);
+    if constexpr(!std::is_same<N, NoWeight>::value){
+        static_assert(sizeof(N)<=GRAPH_FILE_MAX_SIZE, "Weights saved in a binary file can not be larger than 32 bytes.");
+        const N max=g.getMax();
+        std::memcpy(header.max, &max, sizeof(N));
+    }
+
+    std::ofstream out(path, std::ios::binary|std::ios::trunc);
+    if(!out) return false;
+    out.write((const char*)&header, sizeof(header));
+    if(!graphFileWritePadding(out, header.offsets_position)) return false;
+    out.write((const char*)g.getOffsets(), ((uint64_t)header.size+1)*sizeof(uint64_t));
+    if(!graphFileWritePadding(out, header.targets_position)) return false;
+    out.write((const char*)g.getTargets(), header.entries*sizeof(uint32_t));
+    if(!graphFileWritePadding(out, header.weights_position)) return false;
+    if constexpr(!std::is_same<N, NoWeight>::value){
+        out.write((const char*)g.getWeights(), header.entries*sizeof(N));
+    }
+    out.flush();
+    return (bool)out;
+}
+
+//returns a graph that works directly on the mapped file (nothing is copied) or nullptr if the file can not be used as G
+//only the header and the bounds of the arrays are checked, verify additionally checks every offset and target in O(V+E)
+template<typename G>
+G* mapBinaryGraph(const char *path, const bool verify=false){
+    typedef typename GraphFileType<G>::weight N;
+    const bool weighted=!std::is_same<N, NoWeight>::value;
+    std::shared_ptr<MappedFile> file=std::make_shared<MappedFile>(path);
+    if(!file->isOpen()){
+        printErrorMsg(1, "mapBinaryGraph: the file can not be opened.");
+        return nullptr;
+    }
+    if(file->getLength()<sizeof(GraphFileHeader)){
+        printErrorMsg(1, "mapBinaryGraph: the file is too short.");
+        return nullptr;
+    }
+    GraphFileHeader header;
+    std::memcpy(&header, file->getData(), sizeof(header));
+    if(std::memcmp(header.magic, GRAPH_FILE_MAGIC, 8)!=0 || header.version!=GRAPH_FILE_VERSION){
+        printErrorMsg(1, "mapBinaryGraph: the file is not a graph file in a supported version.");
+        return nullptr;
+    }
+    if(((header.flags&GRAPH_FILE_DIRECTED)!=0)!=GraphFileType<G>::directed || ((header.flags&GRAPH_FILE_WEIGHTED)!=0)!=weighted){
+        printErrorMsg(1, "mapBinaryGraph: the type of the graph in the file is different from the requested one.");
+        return nullptr;
+    }
+    if(header.weight_kind!=graphFileWeightKind<N>() || header.weight_size!=(weighted ? sizeof(N) : 0)){
+        printErrorMsg(1, "mapBinaryGraph: the type of the weights in the file is different from the requested one.");
+        return nullptr;
+    }
+    //the positions are ordered and bounded by the file first, so the sizes are compared with differences and nothing can overflow
+    if(header.file_size>file->getLength()
+        || header.offsets_position%GRAPH_FILE_ALIGNMENT || header.targets_position%GRAPH_FILE_ALIGNMENT || header.weights_position%GRAPH_FILE_ALIGNMENT
+        || header.offsets_position>header.targets_position || header.targets_position>header.weights_position || header.weights_position>header.file_size
+        || (uint64_t)header.size+1>(header.targets_position-header.offsets_position)/sizeof(uint64_t)
+        || header.entries>(header.weights_position-header.targets_position)/sizeof(uint32_t)
+        || (weighted && header.entries>(header.file_size-header.weights_position)/sizeof(N))){
+        printErrorMsg(1, "mapBinaryGraph: the sections of the file are damaged.");
+        return nullptr;
+    }
+    const char *base=(const char*)file->getData();
+    CSRView view;
+    view.size=header.size;
+    view.number_of_edges=header.number_of_edges;
+    view.offsets=(const uint64_t*)(base+header.offsets_position);
+    view.targets=(const uint32_t*)(base+header.targets_position);
+    view.weights=weighted ? base+header.weights_position : nullptr;
+    if(view.offsets[0]!=0 || view.offsets[header.size]!=header.entries){
+        printErrorMsg(1, "mapBinaryGraph: the offsets in the file are damaged.");
+        return nullptr;
+    }
+    if(verify){
+        for(uint32_t i=0;i<header.size;++i){
+            if(view.offsets[i]>view.offsets[i+1]){
+                printErrorMsg(1, "mapBinaryGraph: the offsets in the file are damaged.");
+                return nullptr;
+            }
+            for(uint64_t j=view.offsets[i];j<view.offsets[i+1];++j){
+                if(view.targets[j]>=header.size || (j>view.offsets[i] && view.targets[j-1]>view.targets[j])){
+                    printErrorMsg(1, "mapBinaryGraph: the targets in the file are damaged.");
+                    return nullptr;
+                }
+            }
+        }
+    }
+    view.owner=file;
+    if constexpr(std::is_same<N, NoWeight>::value){
+        return new G(view);
+    }
+    else{
+        N max;
+        std::memcpy(&max, header.max, sizeof(N));
+        return new G(view, max);
+    }
+}
+
+#endif
@@ -5,8 +5,21 @@
 #include "disjoint_set.h"
 #include "error_info.h"
 #include "graph.h"
+#include "csr_graph.h"
+#include "graph_file.h"
+#include "graph_reader.h"
+#include "thread_pool.h"
+#include "search_workspace.h"
+#include "neighbour_range.h"
+#include "bit_matrix.h"
+#include "dense_matrix.h"
+#include "edge_list.h"
+#include "adjacency_lists.h"
+#include "transposed_view.h"
 #include "heap_node.h"
+#include "node_pool.h"
 #include "heap.h"
 #include "priority_queue.h"
+#include "contraction_hierarchy.h"
 
-#endif
\ No newline at end of file
+#endif
\ No newline at end of file
@@ -0,0 +1,747 @@
+#ifndef GRAPH_READER_H
+#define GRAPH_READER_H
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <cctype>
+#include <cmath>
+#include <algorithm>
+#include <limits>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+#include <utility>
+#include <type_traits>
+#include "graph.h"
+#include "csr_graph.h"
+#include "graph_file.h"
+#include "thread_pool.h"
+#include "error_info.h"
+
+//readers of text formats: DIMACS shortest path (.gr), SNAP edge lists and Matrix Market coordinate files
+//the file is mapped into memory, split into chunks at line boundaries and the chunks are parsed in parallel; CSR graphs are
+//built straight from the text (graphReaderBuildCSR), other graphs get the edges through addEdges in slices (graphReaderAddParts)
+
+#define GRAPH_READER_NUMBER_LENGTH 64
+#define GRAPH_READER_CHUNK_BYTES (1<<24)
+#define GRAPH_READER_SLICE_EDGES (1<<22)
+#define GRAPH_READER_ROW_GROUP 1024
+#define GRAPH_READER_BATCH 256
+
+template<typename G, typename = void>
+struct GraphReaderWeight{
+    typedef NoWeight type;
+};
+
+template<typename G>
+struct GraphReaderWeight<G, std::void_t<decltype(std::declval<const G&>().getMax())>>{
+    typedef typename std::decay<decltype(std::declval<const G&>().getMax())>::type type;
+};
+
+template<typename N>
+struct GraphReaderEdge{
+    typedef std::pair<std::pair<uint32_t, uint32_t>, N> type;
+};
+
+template<>
+struct GraphReaderEdge<NoWeight>{
+    typedef std::pair<uint32_t, uint32_t> type;
+};
+
+template<typename G, typename E, typename = void>
+struct GraphReaderHasSaveFlag : std::false_type{};
+
+template<typename G, typename E>
+struct GraphReaderHasSaveFlag<G, E, std::void_t<decltype(std::declval<G&>().addEdges(std::declval<std::vector<E>>(), true))>> : std::true_type{};
+
+//max of a graph created by a reader: infinity if N has one, the largest value of N otherwise
+template<typename N>
+N graphReaderMax(){
+    if constexpr(std::numeric_limits<N>::has_infinity) return std::numeric_limits<N>::infinity();
+    else return std::numeric_limits<N>::max();
+}
+
+inline void graphReaderPrefetch(const void *address){
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address, 1);
+#else
+    (void)address;
+#endif
+}
+
+inline bool graphReaderIsSpace(const char c){
+    return c==' ' || c=='\t' || c=='\r';
+}
+
+inline void graphReaderSkipSpaces(const char *&p, const char *end){
+    while(p<end && graphReaderIsSpace(*p)) ++p;
+}
+
+inline bool graphReaderParseUnsigned(const char *&p, const char *end, uint64_t &value){
+    const char *start=p;
+    uint64_t result=0;
+    while(p<end && (unsigned char)(*p-'0')<10){
+        if(p-start==19) return false;
+        result=result*10+(*p-'0');
+        ++p;
+    }
+    value=result;
+    return p!=start;
+}
+
+//vertex ids have to fit in uint32_t and leave UINT32_MAX free, base is 1 for formats that count from 1
+inline bool graphReaderParseVertex(const char *&p, const char *end, const uint32_t base, uint32_t &vertex){
+    graphReaderSkipSpaces(p, end);
+    uint64_t value;
+    if(!graphReaderParseUnsigned(p, end, value) || value<base || value-base>=UINT32_MAX) return false;
+    if(p<end && !graphReaderIsSpace(*p)) return false;
+    vertex=value-base;
+    return true;
+}
+
+//numbers that do not fit the fast path are copied into a small buffer and converted by the C library
+template<typename N>
+bool graphReaderParseSlow(const char *start, const char *&p, const char *end, N &value){
+    while(p<end && !graphReaderIsSpace(*p)) ++p;
+    char buffer[GRAPH_READER_NUMBER_LENGTH];
+    if(p-start>=GRAPH_READER_NUMBER_LENGTH) return false;
+    std::memcpy(buffer, start, p-start);
+    buffer[p-start]=0;
+    char *last;
+    if constexpr(std::is_integral<N>::value){
+        if(std::is_signed<N>::value){
+            const long long result=std::strtoll(buffer, &last, 10);
+            if(*last==0){
+                value=(N)result;
+                return true;
+            }
+        }
+        else if(buffer[0]!='-'){
+            const unsigned long long result=std::strtoull(buffer, &last, 10);
+            if(*last==0){
+                value=(N)result;
+                return true;
+            }
+        }
+        //decimal or exponent forms are accepted only if they are whole numbers in the range of N (2.0, 1e3), 1.5 is invalid
+        const long double result=std::strtold(buffer, &last);
+        if(last==buffer || *last!=0 || std::trunc(result)!=result) return false;
+        if(result<(long double)std::numeric_limits<N>::min() || result>(long double)std::numeric_limits<N>::max()) return false;
+        value=(N)result;
+    }
+    else if constexpr(std::is_same<N, float>::value) value=std::strtof(buffer, &last);
+    else if constexpr(std::is_same<N, double>::value) value=std::strtod(buffer, &last);
+    else value=(N)std::strtold(buffer, &last);
+    return last!=buffer && *last==0;
+}
+
+//integers go straight to N, decimals use the exact path (mantissa and power of ten both representable) when possible
+template<typename N>
+bool graphReaderParseNumber(const char *&p, const char *end, N &value){
+    static const double powers[]={1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+    graphReaderSkipSpaces(p, end);
+    const char *start=p;
+    bool negative=false;
+    if(p<end && (*p=='-' || *p=='+')){
+        negative=*p=='-';
+        ++p;
+    }
+    uint64_t mantissa=0;
+    uint32_t digits=0;
+    int32_t exponent=0;
+    bool any=false;
+    for(;p<end && (unsigned char)(*p-'0')<10;++p){
+        any=true;
+        if(digits==19) return graphReaderParseSlow(start, p, end, value);
+        mantissa=mantissa*10+(*p-'0');
+        if(mantissa!=0) ++digits;
+    }
+    if(p<end && *p=='.'){
+        for(++p;p<end && (unsigned char)(*p-'0')<10;++p){
+            any=true;
+            if(digits==19) return graphReaderParseSlow(start, p, end, value);
+            mantissa=mantissa*10+(*p-'0');
+            if(mantissa!=0) ++digits;
+            --exponent;
+        }
+    }
+    if(!any) return graphReaderParseSlow(start, p, end, value);
+    if(p<end && (*p=='e' || *p=='E')){
+        ++p;
+        bool negative_exponent=false;
+        if(p<end && (*p=='-' || *p=='+')){
+            negative_exponent=*p=='-';
+            ++p;
+        }
+        uint64_t e;
+        if(!graphReaderParseUnsigned(p, end, e) || e>1000) return graphReaderParseSlow(start, p, end, value);
+        exponent+=negative_exponent ? -(int32_t)e : (int32_t)e;
+    }
+    if(p<end && !graphReaderIsSpace(*p)) return false;
+    if constexpr(std::is_integral<N>::value){
+        if(exponent!=0 || (negative && !std::is_signed<N>::value)) return graphReaderParseSlow(start, p, end, value);
+        value=negative ? (N)(0-mantissa) : (N)mantissa;
+        return true;
+    }
+    else{
+        const bool exact=std::is_same<N, float>::value ? mantissa<=(1ull<<24) && exponent>=-10 && exponent<=10
+            : mantissa<=(1ull<<53) && exponent>=-22 && exponent<=22;
+        if(!exact || (!std::is_same<N, float>::value && !std::is_same<N, double>::value)) return graphReaderParseSlow(start, p, end, value);
+        if constexpr(std::is_same<N, float>::value){
+            float result=(float)mantissa;
+            result=exponent<0 ? result/(float)powers[-exponent] : result*(float)powers[exponent];
+            value=negative ? -result : result;
+        }
+        else{
+            double result=(double)mantissa;
+            result=exponent<0 ? result/powers[-exponent] : result*powers[exponent];
+            value=negative ? -result : result;
+        }
+        return true;
+    }
+}
+
+inline const char *graphReaderLineEnd(const char *p, const char *end){
+    const char *nl=(const char*)std::memchr(p, '\n', end-p);
+    return nl ? nl : end;
+}
+
+inline uint64_t graphReaderLineNumber(const char *begin, const char *position){
+    uint64_t result=1;
+    for(const char *p=begin;(p=(const char*)std::memchr(p, '\n', position-p));++p) ++result;
+    return result;
+}
+
+//splits <begin;end) at line boundaries into chunks of about GRAPH_READER_CHUNK_BYTES, but at least one chunk per thread
+inline std::vector<const char*> graphReaderSplit(const char *begin, const char *end, const uint32_t threads){
+    const uint64_t length=end-begin;
+    const uint64_t chunks=std::max<uint64_t>(threads, (length+GRAPH_READER_CHUNK_BYTES-1)/GRAPH_READER_CHUNK_BYTES);
+    std::vector<const char*>bounds(chunks+1);
+    bounds[0]=begin;
+    bounds[chunks]=end;
+    for(uint64_t i=1;i<chunks;++i){
+        const char *p=begin+length*i/chunks;
+        if(p<bounds[i-1]) p=bounds[i-1];
+        else if(p>begin && p[-1]!='\n') p=std::min(graphReaderLineEnd(p, end)+1, end);
+        bounds[i]=p;
+    }
+    return bounds;
+}
+
+//calls parseLine(line, line_end, out, max_vertex) for every line, it writes at most perLine edges to out and returns their number
+//or -1 for an invalid line; chunks are handed out to the threads through an atomic counter and emit(chunk, edges, count)
+//receives the edges of one chunk on one thread in the order of the file, in batches of about GRAPH_READER_BATCH edges
+//(so random accesses of emit can be prefetched together); on failure error points at the first invalid line
+template<typename E, typename F, typename H>
+bool graphReaderScan(ThreadPool &pool, const std::vector<const char*> &bounds, const uint32_t perLine, const F &parseLine, const H &emit,
+    uint32_t &maxVertex, const char *&error){
+    const uint64_t chunks=bounds.size()-1;
+    std::vector<uint32_t>maxima(chunks, 0);
+    std::vector<const char*>errors(chunks, nullptr);
+    std::atomic<uint64_t>next(0);
+    pool.run([&](const uint32_t){
+        std::vector<E>batch(GRAPH_READER_BATCH+perLine);
+        for(uint64_t c=next.fetch_add(1);c<chunks;c=next.fetch_add(1)){
+            uint32_t max=0;
+            uint64_t count=0;
+            for(const char *p=bounds[c];p<bounds[c+1];){
+                const char *line_end=graphReaderLineEnd(p, bounds[c+1]);
+                const int32_t result=parseLine(p, line_end, batch.data()+count, max);
+                if(result<0){
+                    errors[c]=p;
+                    break;
+                }
+                count+=result;
+                if(count>=GRAPH_READER_BATCH){
+                    emit(c, batch.data(), count);
+                    count=0;
+                }
+                p=line_end+1;
+            }
+            if(count && !errors[c]) emit(c, batch.data(), count);
+            maxima[c]=max;
+        }
+    });
+    maxVertex=0;
+    for(uint64_t c=0;c<chunks;++c){
+        if(errors[c]){
+            error=errors[c];
+            return false;
+        }
+        maxVertex=std::max(maxVertex, maxima[c]);
+    }
+    return true;
+}
+
+//parses every chunk into its own edge list, reserved for perLine edges per line and shrunk if comments took much of it
+template<typename E, typename F>
+bool graphReaderParseParts(ThreadPool &pool, const std::vector<const char*> &bounds, const uint32_t perLine, const F &parseLine,
+    std::vector<std::vector<E>> &parts, uint32_t &maxVertex, const char *&error){
+    parts.assign(bounds.size()-1, std::vector<E>());
+    parallelForBlocks(pool, 0, parts.size(), [&](const uint32_t, const uint64_t b, const uint64_t e){
+        for(uint64_t c=b;c<e;++c){
+            uint64_t lines=0;
+            for(const char *p=bounds[c];p<bounds[c+1];p=graphReaderLineEnd(p, bounds[c+1])+1) ++lines;
+            parts[c].reserve(lines*perLine);
+        }
+    });
+    const bool result=graphReaderScan<E>(pool, bounds, perLine, parseLine, [&parts](const uint64_t c, const E *edges, const uint64_t count){
+        parts[c].insert(parts[c].end(), edges, edges+count);
+    }, maxVertex, error);
+    for(auto &part : parts){
+        if(!result) std::vector<E>().swap(part);
+        else if(part.size()<part.capacity()/2) part.shrink_to_fit();
+    }
+    return result;
+}
+
+template<typename G, typename... Args>
+G* graphReaderCreate(const uint32_t size, Args... args){
+    typedef typename GraphReaderWeight<G>::type N;
+    if constexpr(std::is_same<N, NoWeight>::value) return new G(size, args...);
+    else return new G(size, graphReaderMax<N>(), args...);
+}
+
+//CSR graphs are built from the edges in the constructor, other graphs receive them through addEdges
+template<typename G, typename E>
+void graphReaderAddEdges(G *g, std::vector<E> &edges, const bool deduplicate){
+    if constexpr(GraphReaderHasSaveFlag<G, E>::value) g->addEdges(std::move(edges), deduplicate);
+    else g->addEdges(edges);
+}
+
+//moves the parsed edges into g in slices of about GRAPH_READER_SLICE_EDGES edges whose first endpoints (the smaller endpoints
+//in undirected graphs) form a range of vertexes, so every list of a directed graph is built by one addEdges call, duplicates
+//always fall into one slice and the sort scratch of addEdges never exceeds a slice; every part and slice is released as soon
+//as it is used, so the memory holds the edges once plus one slice
+template<typename G, typename E>
+void graphReaderAddParts(G *g, std::vector<std::vector<E>> &parts, const bool deduplicate){
+    const bool directed=g->isDirected();
+    auto key=[directed](const E &edge){
+        const std::pair<uint32_t, uint32_t> &p=edgeEndpoints(edge);
+        return directed ? p.first : std::min(p.first, p.second);
+    };
+    //the number of edges of every key, then the slice of every key
+    std::vector<uint32_t>slice_of(g->getSize(), 0);
+    for(auto &part : parts){
+        for(auto &edge : part) ++slice_of[key(edge)];
+    }
+    std::vector<uint64_t>sizes(1, 0);
+    for(uint32_t &v : slice_of){
+        if(sizes.back()>0 && sizes.back()+v>GRAPH_READER_SLICE_EDGES) sizes.push_back(0);
+        sizes.back()+=v;
+        v=sizes.size()-1;
+    }
+    std::vector<std::vector<E>>slices(sizes.size());
+    for(uint64_t i=0;i<sizes.size();++i) slices[i].reserve(sizes[i]);
+    for(auto &part : parts){
+        for(auto &edge : part) slices[slice_of[key(edge)]].push_back(edge);
+        std::vector<E>().swap(part);
+    }
+    std::vector<uint32_t>().swap(slice_of);
+    for(auto &slice : slices){
+        graphReaderAddEdges(g, slice, deduplicate);
+        std::vector<E>().swap(slice);
+    }
+}
+
+//builds a CSR graph straight from the text without an edge list: the first scan counts the entries of every row, the second one
+//writes them to their rows (atomic cursors), then every row is sorted (and deduplicated) in parallel and the rows are packed
+//an entry lands anywhere in its row, but the entries of one chunk keep their order, so deduplicate still keeps the last edge
+//of the file (for weighted graphs the chunk of every entry is kept until then); the file is released before the rows are sorted
+template<typename G, typename E, typename F>
+G* graphReaderBuildCSR(ThreadPool &pool, const std::vector<const char*> &bounds, const uint32_t perLine, const F &parseLine,
+    const uint32_t n, const bool deduplicate, MappedFile &file, const char *&error){
+    typedef typename GraphReaderWeight<G>::type N;
+    constexpr bool weighted=!std::is_same<N, NoWeight>::value;
+    const bool symmetric=!GraphFileType<G>::directed;
+    std::vector<std::atomic<uint64_t>>cursor(n);
+    for(auto &c : cursor) c.store(0, std::memory_order_relaxed);
+    uint32_t max_vertex;
+    const bool result=graphReaderScan<E>(pool, bounds, perLine, parseLine, [&](const uint64_t, const E *edges, const uint64_t count){
+        for(uint64_t i=0;i<count;++i){
+            const std::pair<uint32_t, uint32_t> &p=edgeEndpoints(edges[i]);
+            graphReaderPrefetch(&cursor[p.first]);
+            if(symmetric) graphReaderPrefetch(&cursor[p.second]);
+        }
+        for(uint64_t i=0;i<count;++i){
+            const std::pair<uint32_t, uint32_t> &p=edgeEndpoints(edges[i]);
+            cursor[p.first].fetch_add(1, std::memory_order_relaxed);
+            if(symmetric && p.first!=p.second) cursor[p.second].fetch_add(1, std::memory_order_relaxed);
+        }
+    }, max_vertex, error);
+    if(!result) return nullptr;
+    std::vector<uint64_t>offsets(n+1, 0);
+    for(uint32_t i=0;i<n;++i){
+        offsets[i+1]=offsets[i]+cursor[i].load(std::memory_order_relaxed);
+        cursor[i].store(offsets[i], std::memory_order_relaxed);
+    }
+    const uint64_t entries=offsets[n];
+    std::vector<uint32_t>targets(entries);
+    std::vector<N>weights(weighted ? entries : 0);
+    std::vector<uint32_t>chunk_of(weighted && deduplicate ? entries : 0);
+    //the positions of a batch are taken first, so the writes to targets and weights can be prefetched together
+    graphReaderScan<E>(pool, bounds, perLine, parseLine, [&](const uint64_t chunk, const E *edges, const uint64_t count){
+        uint64_t positions[2*GRAPH_READER_BATCH+2];
+        for(uint64_t i=0;i<count;++i){
+            const std::pair<uint32_t, uint32_t> &p=edgeEndpoints(edges[i]);
+            graphReaderPrefetch(&cursor[p.first]);
+            if(symmetric) graphReaderPrefetch(&cursor[p.second]);
+        }
+        for(uint64_t i=0;i<count;++i){
+            const std::pair<uint32_t, uint32_t> &p=edgeEndpoints(edges[i]);
+            positions[2*i]=cursor[p.first].fetch_add(1, std::memory_order_relaxed);
+            graphReaderPrefetch(&targets[positions[2*i]]);
+            if(symmetric && p.first!=p.second){
+                positions[2*i+1]=cursor[p.second].fetch_add(1, std::memory_order_relaxed);
+                graphReaderPrefetch(&targets[positions[2*i+1]]);
+            }
+        }
+        for(uint64_t i=0;i<count;++i){
+            const std::pair<uint32_t, uint32_t> &p=edgeEndpoints(edges[i]);
+            const uint32_t copies=symmetric && p.first!=p.second ? 2 : 1;
+            for(uint32_t k=0;k<copies;++k){
+                const uint64_t idx=positions[2*i+k];
+                targets[idx]=k ? p.first : p.second;
+                if constexpr(weighted){
+                    weights[idx]=edges[i].second;
+                    if(deduplicate) chunk_of[idx]=chunk;
+                }
+            }
+        }
+    }, max_vertex, error);
+    file.release();
+    //rows are handed out in groups through an atomic counter, the new length of every row goes back to its cursor
+    std::atomic<uint64_t>next(0);
+    pool.run([&](const uint32_t){
+        std::vector<std::pair<uint32_t, N>>row;
+        std::vector<uint64_t>order;
+        for(uint64_t first=next.fetch_add(GRAPH_READER_ROW_GROUP);first<n;first=next.fetch_add(GRAPH_READER_ROW_GROUP)){
+            for(uint32_t r=first;r<std::min<uint64_t>(first+GRAPH_READER_ROW_GROUP, n);++r){
+                const uint64_t b=offsets[r], e=offsets[r+1];
+                uint64_t length=e-b;
+                if constexpr(!weighted){
+                    std::sort(targets.begin()+b, targets.begin()+e);
+                    if(deduplicate) length=std::unique(targets.begin()+b, targets.begin()+e)-targets.begin()-b;
+                }
+                else if(!deduplicate){
+                    row.clear();
+                    for(uint64_t j=b;j<e;++j) row.push_back(std::pair<uint32_t, N>(targets[j], weights[j]));
+                    std::sort(row.begin(), row.end());
+                    for(uint64_t j=b;j<e;++j){
+                        targets[j]=row[j-b].first;
+                        weights[j]=row[j-b].second;
+                    }
+                }
+                else{
+                    order.resize(length);
+                    for(uint64_t j=0;j<length;++j) order[j]=b+j;
+                    std::sort(order.begin(), order.end(), [&](const uint64_t x, const uint64_t y){
+                        if(targets[x]!=targets[y]) return targets[x]<targets[y];
+                        if(chunk_of[x]!=chunk_of[y]) return chunk_of[x]<chunk_of[y];
+                        return x<y;
+                    });
+                    row.clear();
+                    for(uint64_t j=0;j<length;++j){
+                        if(j+1<length && targets[order[j]]==targets[order[j+1]]) continue;
+                        row.push_back(std::pair<uint32_t, N>(targets[order[j]], weights[order[j]]));
+                    }
+                    length=row.size();
+                    for(uint64_t j=0;j<length;++j){
+                        targets[b+j]=row[j].first;
+                        weights[b+j]=row[j].second;
+                    }
+                }
+                cursor[r].store(length, std::memory_order_relaxed);
+            }
+        }
+    });
+    std::vector<uint32_t>().swap(chunk_of);
+    if(deduplicate){
+        uint64_t out=0;
+        for(uint32_t r=0;r<n;++r){
+            const uint64_t b=offsets[r], length=cursor[r].load(std::memory_order_relaxed);
+            offsets[r]=out;
+            if(out!=b){
+                std::copy(targets.begin()+b, targets.begin()+b+length, targets.begin()+out);
+                if constexpr(weighted) std::copy(weights.begin()+b, weights.begin()+b+length, weights.begin()+out);
+            }
+            out+=length;
+        }
+        offsets[n]=out;
+        if(out!=entries){
+            targets.resize(out);
+            targets.shrink_to_fit();
+            if constexpr(weighted){
+                weights.resize(out);
+                weights.shrink_to_fit();
+            }
+        }
+    }
+    std::vector<std::atomic<uint64_t>>().swap(cursor);
+    if constexpr(weighted) return new G(std::move(offsets), std::move(targets), std::move(weights), graphReaderMax<N>());
+    else return new G(std::move(offsets), std::move(targets));
+}
+
+inline void graphReaderLineError(const char *function, const char *begin, const char *line){
+    const std::string message=std::string(function)+": the line "+std::to_string(graphReaderLineNumber(begin, line))+" is invalid.";
+    printErrorMsg(1, message.c_str());
+}
+
+//DIMACS shortest path format: "c" comments, a problem line "p sp <vertexes> <edges>" and arcs "a <from> <to> <weight>" counted from 1
+//threads=0 uses every hardware thread, deduplicate keeps only the last of parallel edges (saveFlag of addEdges)
+//args are passed to the constructor of G after the size (and max for weighted graphs), e.g. the AdjacencyIndex of list graphs
+//weighted graphs get infinity (or the largest value of N) as max, unweighted graphs ignore the weights
+template<typename G, typename... Args>
+G* readDimacsGraph(const char *path, const uint32_t threads=0, const bool deduplicate=false, Args... args){
+    typedef typename GraphReaderWeight<G>::type N;
+    typedef typename GraphReaderEdge<N>::type E;
+    MappedFile file(path);
+    if(!file.isOpen()){
+        printErrorMsg(1, "readDimacsGraph: the file can not be opened.");
+        return nullptr;
+    }
+    const char *begin=(const char*)file.getData();
+    const char *end=begin+file.getLength();
+    const char *p=begin;
+    uint64_t size=0;
+    bool found=false;
+    while(p<end && !found){
+        const char *line_end=graphReaderLineEnd(p, end);
+        const char *q=p;
+        graphReaderSkipSpaces(q, line_end);
+        if(q<line_end && *q=='p'){
+            ++q;
+            graphReaderSkipSpaces(q, line_end);
+            while(q<line_end && !graphReaderIsSpace(*q)) ++q;
+            graphReaderSkipSpaces(q, line_end);
+            if(!graphReaderParseUnsigned(q, line_end, size) || size>=UINT32_MAX){
+                graphReaderLineError("readDimacsGraph", begin, p);
+                return nullptr;
+            }
+            found=true;
+        }
+        else if(q<line_end && *q!='c'){
+            graphReaderLineError("readDimacsGraph", begin, p);
+            return nullptr;
+        }
+        p=line_end+1;
+    }
+    if(!found){
+        printErrorMsg(1, "readDimacsGraph: the file has no problem line.");
+        return nullptr;
+    }
+    const uint32_t n=size;
+    ThreadPool pool(threads);
+    const std::vector<const char*>bounds=graphReaderSplit(std::min(p, end), end, pool.getSize());
+    auto parseLine=[n](const char *q, const char *line_end, E *out, uint32_t&)->int32_t{
+        graphReaderSkipSpaces(q, line_end);
+        if(q==line_end || *q=='c') return 0;
+        if(*q!='a') return -1;
+        ++q;
+        uint32_t from, to;
+        if(!graphReaderParseVertex(q, line_end, 1, from) || !graphReaderParseVertex(q, line_end, 1, to) || from>=n || to>=n) return -1;
+        if constexpr(std::is_same<N, NoWeight>::value){
+            *out=E(from, to);
+        }
+        else{
+            N weight;
+            if(!graphReaderParseNumber(q, line_end, weight)) return -1;
+            *out=E(std::pair<uint32_t, uint32_t>(from, to), weight);
+        }
+        return 1;
+    };
+    const char *error;
+    if constexpr(std::is_base_of<CSRGraphBase, G>::value){
+        G *g=graphReaderBuildCSR<G, E>(pool, bounds, 1, parseLine, n, deduplicate, file, error);
+        if(!g) graphReaderLineError("readDimacsGraph", begin, error);
+        return g;
+    }
+    else{
+        std::vector<std::vector<E>>parts;
+        uint32_t max_vertex;
+        if(!graphReaderParseParts<E>(pool, bounds, 1, parseLine, parts, max_vertex, error)){
+            graphReaderLineError("readDimacsGraph", begin, error);
+            return nullptr;
+        }
+        file.release();
+        G *g=graphReaderCreate<G>(n, args...);
+        graphReaderAddParts(g, parts, deduplicate);
+        return g;
+    }
+}
+
+//SNAP edge list: "#" or "%" comments and lines "<from> <to>" (optionally followed by a weight) counted from 0
+//the number of vertexes is the largest id plus one, edges without a weight get N(1), other parameters as in readDimacsGraph
+template<typename G, typename... Args>
+G* readSnapGraph(const char *path, const uint32_t threads=0, const bool deduplicate=false, Args... args){
+    typedef typename GraphReaderWeight<G>::type N;
+    typedef typename GraphReaderEdge<N>::type E;
+    MappedFile file(path);
+    if(!file.isOpen()){
+        printErrorMsg(1, "readSnapGraph: the file can not be opened.");
+        return nullptr;
+    }
+    const char *begin=(const char*)file.getData();
+    const char *end=begin+file.getLength();
+    ThreadPool pool(threads);
+    const std::vector<const char*>bounds=graphReaderSplit(begin, end, pool.getSize());
+    auto parseLine=[](const char *q, const char *line_end, E *out, uint32_t &max)->int32_t{
+        graphReaderSkipSpaces(q, line_end);
+        if(q==line_end || *q=='#' || *q=='%') return 0;
+        uint32_t from, to;
+        if(!graphReaderParseVertex(q, line_end, 0, from) || !graphReaderParseVertex(q, line_end, 0, to) || from==UINT32_MAX-1 || to==UINT32_MAX-1) return -1;
+        max=std::max(max, std::max(from, to)+1);
+        if constexpr(std::is_same<N, NoWeight>::value){
+            *out=E(from, to);
+        }
+        else{
+            N weight=N(1);
+            graphReaderSkipSpaces(q, line_end);
+            if(q<line_end && !graphReaderParseNumber(q, line_end, weight)) return -1;
+            *out=E(std::pair<uint32_t, uint32_t>(from, to), weight);
+        }
+        return 1;
+    };
+    uint32_t max_vertex;
+    const char *error;
+    if constexpr(std::is_base_of<CSRGraphBase, G>::value){
+        //the number of vertexes is needed before the rows are counted, so the file is scanned once more
+        if(!graphReaderScan<E>(pool, bounds, 1, parseLine, [](const uint64_t, const E*, const uint64_t){}, max_vertex, error)){
+            graphReaderLineError("readSnapGraph", begin, error);
+            return nullptr;
+        }
+        return graphReaderBuildCSR<G, E>(pool, bounds, 1, parseLine, max_vertex, deduplicate, file, error);
+    }
+    else{
+        std::vector<std::vector<E>>parts;
+        if(!graphReaderParseParts<E>(pool, bounds, 1, parseLine, parts, max_vertex, error)){
+            graphReaderLineError("readSnapGraph", begin, error);
+            return nullptr;
+        }
+        file.release();
+        G *g=graphReaderCreate<G>(max_vertex, args...);
+        graphReaderAddParts(g, parts, deduplicate);
+        return g;
+    }
+}
+
+//Matrix Market: "%%MatrixMarket matrix coordinate <real|double|integer|pattern> <general|symmetric|skew-symmetric>",
+//"%" comments, a line "<rows> <columns> <entries>" and entries "<row> <column> [value]" counted from 1
+//the graph has max(rows, columns) vertexes and an edge row -> column for every entry, pattern entries get N(1)
+//directed graphs get both directions of every off-diagonal entry of a symmetric matrix (with a negated value if it is skew-symmetric)
+//other parameters as in readDimacsGraph
+template<typename G, typename... Args>
+G* readMatrixMarketGraph(const char *path, const uint32_t threads=0, const bool deduplicate=false, Args... args){
+    typedef typename GraphReaderWeight<G>::type N;
+    typedef typename GraphReaderEdge<N>::type E;
+    MappedFile file(path);
+    if(!file.isOpen()){
+        printErrorMsg(1, "readMatrixMarketGraph: the file can not be opened.");
+        return nullptr;
+    }
+    const char *begin=(const char*)file.getData();
+    const char *end=begin+file.getLength();
+    const char *line_end=graphReaderLineEnd(begin, end);
+    std::vector<std::string>banner;
+    for(const char *q=begin;q<line_end;){
+        graphReaderSkipSpaces(q, line_end);
+        const char *word=q;
+        while(q<line_end && !graphReaderIsSpace(*q)) ++q;
+        if(q==word) break;
+        std::string token(word, q);
+        for(char &c : token) c=std::tolower((unsigned char)c);
+        banner.push_back(token);
+    }
+    if(banner.size()!=5 || banner[0]!="%%matrixmarket" || banner[1]!="matrix"){
+        printErrorMsg(1, "readMatrixMarketGraph: the file has no Matrix Market header.");
+        return nullptr;
+    }
+    const bool pattern=banner[3]=="pattern";
+    const bool symmetric=banner[4]=="symmetric" || banner[4]=="skew-symmetric";
+    const bool skew=banner[4]=="skew-symmetric";
+    if(banner[2]!="coordinate" || (!pattern && banner[3]!="real" && banner[3]!="double" && banner[3]!="integer") || (!symmetric && banner[4]!="general")){
+        printErrorMsg(1, "readMatrixMarketGraph: only coordinate matrices with real, integer or pattern entries which are general, symmetric or skew-symmetric are supported.");
+        return nullptr;
+    }
+    if constexpr(!std::is_same<N, NoWeight>::value && !std::is_signed<N>::value){
+        if(skew){
+            printErrorMsg(1, "readMatrixMarketGraph: a skew-symmetric matrix needs signed weights.");
+            return nullptr;
+        }
+    }
+    const char *p=std::min(line_end+1, end);
+    uint64_t rows=0, columns=0;
+    bool found=false;
+    while(p<end && !found){
+        line_end=graphReaderLineEnd(p, end);
+        const char *q=p;
+        graphReaderSkipSpaces(q, line_end);
+        if(q<line_end && *q!='%'){
+            uint64_t entries;
+            if(!graphReaderParseUnsigned(q, line_end, rows) || (graphReaderSkipSpaces(q, line_end), !graphReaderParseUnsigned(q, line_end, columns))
+                || (graphReaderSkipSpaces(q, line_end), !graphReaderParseUnsigned(q, line_end, entries)) || rows>=UINT32_MAX || columns>=UINT32_MAX){
+                graphReaderLineError("readMatrixMarketGraph", begin, p);
+                return nullptr;
+            }
+            found=true;
+        }
+        p=line_end+1;
+    }
+    if(!found){
+        printErrorMsg(1, "readMatrixMarketGraph: the file has no size line.");
+        return nullptr;
+    }
+    const uint32_t n=std::max(rows, columns);
+    //the graph is created before the entries are read (it decides whether a symmetric matrix is mirrored) and released as G on an error
+    std::unique_ptr<G>g;
+    bool directed;
+    if constexpr(std::is_base_of<CSRGraphBase, G>::value){
+        directed=GraphFileType<G>::directed;
+    }
+    else{
+        g.reset(graphReaderCreate<G>(n, args...));
+        directed=g->isDirected();
+    }
+    const bool mirror=symmetric && directed;
+    ThreadPool pool(threads);
+    const std::vector<const char*>bounds=graphReaderSplit(std::min(p, end), end, pool.getSize());
+    auto parseLine=[rows, columns, pattern, mirror, skew](const char *q, const char *line_end, E *out, uint32_t&)->int32_t{
+        graphReaderSkipSpaces(q, line_end);
+        if(q==line_end || *q=='%') return 0;
+        uint32_t from, to;
+        if(!graphReaderParseVertex(q, line_end, 1, from) || !graphReaderParseVertex(q, line_end, 1, to) || from>=rows || to>=columns) return -1;
+        const bool both=mirror && from!=to;
+        if constexpr(std::is_same<N, NoWeight>::value){
+            out[0]=E(from, to);
+            if(both) out[1]=E(to, from);
+        }
+        else{
+            N weight=N(1);
+            if(!pattern && !graphReaderParseNumber(q, line_end, weight)) return -1;
+            out[0]=E(std::pair<uint32_t, uint32_t>(from, to), weight);
+            if(both) out[1]=E(std::pair<uint32_t, uint32_t>(to, from), skew ? N(-weight) : weight);
+        }
+        return both ? 2 : 1;
+    };
+    const char *error;
+    if constexpr(std::is_base_of<CSRGraphBase, G>::value){
+        G *csr=graphReaderBuildCSR<G, E>(pool, bounds, mirror ? 2 : 1, parseLine, n, deduplicate, file, error);
+        if(!csr) graphReaderLineError("readMatrixMarketGraph", begin, error);
+        return csr;
+    }
+    else{
+        std::vector<std::vector<E>>parts;
+        uint32_t max_vertex;
+        if(!graphReaderParseParts<E>(pool, bounds, mirror ? 2 : 1, parseLine, parts, max_vertex, error)){
+            graphReaderLineError("readMatrixMarketGraph", begin, error);
+            return nullptr;
+        }
+        file.release();
+        graphReaderAddParts(g.get(), parts, deduplicate);
+        return g.release();
+    }
+}
+
+#endif
@@ -1,14 +1,29 @@
 #ifndef HEAP_H
 #define HEAP_H
 
-#define CONSOLIDATE_SIZE 32
+#define CONSOLIDATE_SIZE 64
 #define BINOMIAL_HEAP_LIST_SIZE 32
+#define RADIX_HEAP_BUCKETS 65
+#define BUCKET_QUEUE_INITIAL_SIZE 64
 #include <vector>
 #include <algorithm>
 #include <cstdint>
+#include <type_traits>
 #include "heap_node.h"
+#include "node_pool.h"
 #include "error_info.h"
 
+//number of significant bits of word (position of the highest set bit plus one), 0 for 0
+inline uint32_t significantBits(const uint64_t word){
+#if defined(__GNUC__) || defined(__clang__)
+    return word ? 64-__builtin_clzll(word) : 0;
+#else
+    uint32_t result=0;
+    for(uint64_t d=word;d;d>>=1) ++result;
+    return result;
+#endif
+}
+
 template<typename N>
 class Heap {
 public:
@@ -18,6 +33,8 @@ public:
     virtual uint32_t extractMin()=0;
     virtual HeapNode insert(const uint32_t, const N&)=0;
     virtual void decreaseValue(HeapNode*, const N&)=0;
+    //the largest number of elements stored at once, heaps that allocate nodes from a pool use it to size the pool
+    virtual void setMaximumSize(const uint32_t){}
 };
 
 template<typename N>
@@ -184,84 +201,83 @@ public:
 template<typename N>
 class BinomialHeap : public Heap<N> {
 private:
-    struct BinomialHeapNode{
+    struct BinomialHeapNode;
+
+    //element of the heap, a handle returned by insert points at it, decreaseValue moves items between nodes of a tree
+    struct BinomialHeapItem{
         uint32_t key;
         N value;
-        BinomialHeapNode *parent;
-        uint32_t degree;
-        std::vector<BinomialHeapNode*>*children;
-        std::vector<BinomialHeapNode*>*ptr_to_list;
+        BinomialHeapNode *node;
 
-        BinomialHeapNode(const uint32_t key, const N &value){
+        BinomialHeapItem(const uint32_t key, const N &value){
             this->key=key;
             this->value=value;
+            this->node=nullptr;
+        }
+    };
+
+    struct BinomialHeapNode{
+        BinomialHeapItem *item;
+        BinomialHeapNode *parent;
+        BinomialHeapNode *child;
+        BinomialHeapNode *sibling;
+        uint32_t degree;
+
+        BinomialHeapNode(BinomialHeapItem *item){
+            this->item=item;
+            this->parent=this->child=this->sibling=nullptr;
             this->degree=0;
-            this->parent=nullptr;
-            this->children=new std::vector<BinomialHeapNode*>();
-            this->ptr_to_list=nullptr;
+            item->node=this;
         }
     };
 
     uint32_t size;
     std::vector<BinomialHeapNode*>list_of_heads;
+    std::vector<BinomialHeapNode*>merged_list;
+    std::vector<BinomialHeapNode*>list_of_children;
+    NodePool<BinomialHeapItem>items;
+    NodePool<BinomialHeapNode>nodes;
 
     BinomialHeapNode* mergeNodes(BinomialHeapNode *ptr1, BinomialHeapNode *ptr2){
-        BinomialHeapNode *result;
-        if(ptr1->value<ptr2->value){
-            ptr1->children->push_back(ptr2);
-            ptr2->ptr_to_list=ptr1->children;
-            result=ptr1;
-            ++ptr1->degree;
-        }
-        else{
-            ptr2->children->push_back(ptr1);
-            ptr1->ptr_to_list=ptr2->children;
-            result=ptr2;
-            ++ptr2->degree;
+        if(ptr2->item->value<ptr1->item->value){
+            std::swap(ptr1, ptr2);
         }
-        return result;
+        ptr2->parent=ptr1;
+        ptr2->sibling=ptr1->child;
+        ptr1->child=ptr2;
+        ++ptr1->degree;
+        return ptr1;
     }
 
+    //adds two lists of trees indexed by degree like binary numbers
     void mergeLists(std::vector<BinomialHeapNode*>&list_to_merge){
-        if(list_to_merge.size()==0){
-            return;
-        }
-        uint32_t i=0;
-        BinomialHeapNode *ptrFlag=nullptr;
-        std::vector<BinomialHeapNode*>mergedList(BINOMIAL_HEAP_LIST_SIZE, nullptr);
-        while(i<BINOMIAL_HEAP_LIST_SIZE){
-            if(ptrFlag && !this->list_of_heads[i] && !list_to_merge[i]){
-                mergedList[i]=ptrFlag;
-                ptrFlag=nullptr;
-            }
-            else if(!ptrFlag && this->list_of_heads[i] && !list_to_merge[i]){
-                mergedList[i]=this->list_of_heads[i];
-            }
-            else if(!ptrFlag && !this->list_of_heads[i] && list_to_merge[i]){
-                mergedList[i]=list_to_merge[i];
-            }
-            else if(ptrFlag && this->list_of_heads[i] && !list_to_merge[i]){
-                ptrFlag=this->mergeNodes(ptrFlag, this->list_of_heads[i]);
-            }
-            else if(ptrFlag && !this->list_of_heads[i] && list_to_merge[i]){
-                ptrFlag=this->mergeNodes(ptrFlag, list_to_merge[i]);
+        BinomialHeapNode *carry=nullptr;
+        for(uint32_t i=0;i<BINOMIAL_HEAP_LIST_SIZE;++i){
+            BinomialHeapNode *trees[3];
+            uint32_t count=0;
+            if(carry) trees[count++]=carry;
+            if(this->list_of_heads[i]) trees[count++]=this->list_of_heads[i];
+            if(list_to_merge[i]) trees[count++]=list_to_merge[i];
+            this->merged_list[i]=nullptr;
+            carry=nullptr;
+            if(count==1){
+                this->merged_list[i]=trees[0];
             }
-            else if(!ptrFlag && this->list_of_heads[i] && list_to_merge[i]){
-                ptrFlag=this->mergeNodes(this->list_of_heads[i], list_to_merge[i]);
+            else if(count==2){
+                carry=this->mergeNodes(trees[0], trees[1]);
             }
-            else if(ptrFlag && this->list_of_heads[i] && list_to_merge[i]){
-                mergedList[i]=ptrFlag;
-                ptrFlag=this->mergeNodes(this->list_of_heads[i], list_to_merge[i]);
+            else if(count==3){
+                this->merged_list[i]=trees[0];
+                carry=this->mergeNodes(trees[1], trees[2]);
             }
-            ++i;
         }
-        this->list_of_heads=mergedList;
+        this->list_of_heads.swap(this->merged_list);
     }
 
     BinomialHeapNode *findMin() const{
-        BinomialHeapNode *result=this->list_of_heads[0];
-        for(uint32_t i=1;i<BINOMIAL_HEAP_LIST_SIZE;++i){
-            if(this->list_of_heads[i] && (!result || this->list_of_heads[i]->value<result->value)){
+        BinomialHeapNode *result=nullptr;
+        for(uint32_t i=0;i<BINOMIAL_HEAP_LIST_SIZE;++i){
+            if(this->list_of_heads[i] && (!result || this->list_of_heads[i]->item->value<result->item->value)){
                 result=this->list_of_heads[i];
             }
         }
@@ -269,11 +285,12 @@ private:
     }
 
     void dfsDelete(BinomialHeapNode *ptr){
-        if(!ptr){
-            return;
-        }
-        for(uint32_t i=0;i<ptr->children->size();++i){
-            this->dfsDelete(ptr->children->at(i));
+        while(ptr){
+            BinomialHeapNode *next=ptr->sibling;
+            this->dfsDelete(ptr->child);
+            this->items.destroy(ptr->item);
+            this->nodes.destroy(ptr);
+            ptr=next;
         }
     }
 
@@ -281,6 +298,8 @@ public:
     BinomialHeap(){
         this->size=0;
         this->list_of_heads=std::vector<BinomialHeapNode*>(BINOMIAL_HEAP_LIST_SIZE, nullptr);
+        this->merged_list=std::vector<BinomialHeapNode*>(BINOMIAL_HEAP_LIST_SIZE, nullptr);
+        this->list_of_children=std::vector<BinomialHeapNode*>(BINOMIAL_HEAP_LIST_SIZE, nullptr);
     }
 
     ~BinomialHeap(){
@@ -290,6 +309,11 @@ public:
         this->list_of_heads.clear();
     }
 
+    void setMaximumSize(const uint32_t maximum_size) override {
+        this->items.setLimit(maximum_size);
+        this->nodes.setLimit(maximum_size);
+    }
+
     bool isEmpty() const override {
         if(this->getSize()==0){
             return true;
@@ -306,7 +330,7 @@ public:
             printErrorMsg(2, "Trying to get the smallest element from an empty binomial heap.");
         }
         BinomialHeapNode *result=this->findMin();
-        return std::pair<uint32_t, N>(result->key, result->value);
+        return std::pair<uint32_t, N>(result->item->key, result->item->value);
     }
 
     uint32_t extractMin() override {
@@ -314,59 +338,61 @@ public:
             printErrorMsg(2, "Trying to remove the smallest element from an empty binomial heap.");
         }
         BinomialHeapNode *min=this->findMin();
-        const uint32_t key_to_return=min->key;
-        std::vector<BinomialHeapNode*>list_of_c(BINOMIAL_HEAP_LIST_SIZE, nullptr);
-        for(uint32_t i=0;i<min->children->size();++i){
-            list_of_c[min->children->at(i)->degree]=min->children->at(i);
+        const uint32_t key_to_return=min->item->key;
+        std::fill(this->list_of_children.begin(), this->list_of_children.end(), nullptr);
+        for(BinomialHeapNode *ptr=min->child;ptr;){
+            BinomialHeapNode *next=ptr->sibling;
+            ptr->parent=ptr->sibling=nullptr;
+            this->list_of_children[ptr->degree]=ptr;
+            ptr=next;
         }
         this->list_of_heads[min->degree]=nullptr;
-        min->children->clear();
-        delete min->children;
-        delete min;
-        this->mergeLists(list_of_c);
+        this->items.destroy(min->item);
+        this->nodes.destroy(min);
+        this->mergeLists(this->list_of_children);
         --this->size;
         return key_to_return;
     }
 
     HeapNode insert(const uint32_t key, const N &value) override{
-        BinomialHeapNode *ptr=new BinomialHeapNode(key, value);
-        const BinomialHeapNode *r_ptr=ptr;
-        ptr->ptr_to_list=&(this->list_of_heads);
+        BinomialHeapItem *item=this->items.create(key, value);
+        BinomialHeapNode *ptr=this->nodes.create(item);
         while(this->list_of_heads[ptr->degree]){
-            ptr=this->mergeNodes(ptr, this->list_of_heads[ptr->degree]);
-            this->list_of_heads[ptr->degree-1]=nullptr;
+            const uint32_t degree=ptr->degree;
+            ptr=this->mergeNodes(ptr, this->list_of_heads[degree]);
+            this->list_of_heads[degree]=nullptr;
         }
         this->list_of_heads[ptr->degree]=ptr;
         ++this->size;
-        return HeapNode((void*)r_ptr);
+        return HeapNode((void*)item);
     }
 
     void decreaseValue(HeapNode *heap_node, const N &new_value) override{
         if(!heap_node->getPtr()){
-            printErrorMsg(2, "DecreaseKey method in a class that represents binary heap received a pointer to NULL.");
+            printErrorMsg(2, "DecreaseKey method in a class that represents binomial heap received a pointer to NULL.");
         }
-        BinomialHeapNode *ptr=(BinomialHeapNode*)heap_node->getPtr();
-        if(ptr->value<=new_value){
+        BinomialHeapItem *item=(BinomialHeapItem*)heap_node->getPtr();
+        if(item->value<=new_value){
             return;
         }
-        ptr->value=new_value;
-        BinomialHeapNode *ptr_p=ptr->parent;
-        while(ptr_p && ptr->value<ptr_p->value){
-            std::swap(ptr->ptr_to_list->at(ptr->degree), ptr_p->ptr_to_list->at(ptr_p->degree));
-            std::swap(ptr->ptr_to_list, ptr_p->ptr_to_list);
-            ptr=ptr_p;
-            ptr_p=ptr->parent;
+        item->value=new_value;
+        BinomialHeapNode *ptr=item->node;
+        while(ptr->parent && ptr->item->value<ptr->parent->item->value){
+            std::swap(ptr->item, ptr->parent->item);
+            ptr->item->node=ptr;
+            ptr->parent->item->node=ptr->parent;
+            ptr=ptr->parent;
         }
     }
 
     void unionize(BinomialHeap *bh) {
-        if(bh->isEmpty()){
-            delete bh;
-            return;
+        this->items.absorb(bh->items);
+        this->nodes.absorb(bh->nodes);
+        if(!bh->isEmpty()){
+            this->mergeLists(bh->list_of_heads);
+            this->size+=bh->size;
         }
-        this->mergeLists(bh->list_of_heads);
-        this->size+=bh->size;
-        bh->list_of_heads.clear();
+        std::fill(bh->list_of_heads.begin(), bh->list_of_heads.end(), nullptr);
         delete bh;
     }
 };
@@ -396,6 +422,9 @@ private:
     
     FibonacciHeapNode *min;
     uint32_t size;
+    std::vector<FibonacciHeapNode*>consolidate_arr;
+    std::vector<FibonacciHeapNode*>tmp_arr;
+    NodePool<FibonacciHeapNode>nodes;
 
     void addToList(FibonacciHeapNode *ptr, FibonacciHeapNode *listNode){
         if(listNode==nullptr){
@@ -471,7 +500,7 @@ private:
         do{
             ptr2=ptr->right_s;
             priv_dfs(ptr->child);
-            delete ptr;
+            this->nodes.destroy(ptr);
             ptr=ptr2;
         }while(ptr!=node);
     }
@@ -480,12 +509,17 @@ public:
     FibonacciHeap() {
         this->min=nullptr;
         size=0;
+        this->consolidate_arr=std::vector<FibonacciHeapNode*>(CONSOLIDATE_SIZE, nullptr);
     }
 
     ~FibonacciHeap(){
         priv_dfs(this->min);
     }
 
+    void setMaximumSize(const uint32_t maximum_size) override {
+        this->nodes.setLimit(maximum_size);
+    }
+
     bool isEmpty() const override {
         if(this->getSize()==0) return true;
         return false;
@@ -496,7 +530,7 @@ public:
     }
 
     HeapNode insert(const uint32_t key, const N &value) override{
-        FibonacciHeapNode *ptr=new FibonacciHeapNode(key,value);
+        FibonacciHeapNode *ptr=this->nodes.create(key,value);
         addToList(ptr,this->min);
         if(this->min==nullptr || this->min->value>value) this->min=ptr;
         ++this->size;
@@ -516,47 +550,50 @@ public:
         }
         const uint32_t return_key=this->min->key;
         if(this->size==1){
-            delete this->min;
+            this->nodes.destroy(this->min);
             this->min=nullptr;
             this->size=0;
             return return_key;
         } 
 
+        //children of the minimum become roots
         FibonacciHeapNode *p=this->min->child;
-        std::vector<FibonacciHeapNode*>list_of_children;
+        this->tmp_arr.clear();
         if(p!=nullptr){
             do{
-                list_of_children.push_back(p);
+                this->tmp_arr.push_back(p);
                 p=p->right_s;
             }while(p!=this->min->child);
         }
-        for(FibonacciHeapNode *it : list_of_children){
+        for(FibonacciHeapNode *it : this->tmp_arr){
+            it->parent=nullptr;
+            it->mark=false;
             addToList(it, this->min);
         }
 
         p=this->min->right_s;
         this->min->left_s->right_s=this->min->right_s;
         this->min->right_s->left_s=this->min->left_s;
-        delete min;
+        this->nodes.destroy(this->min);
         this->min=p;
 
-        std::vector<FibonacciHeapNode*>consolidate_arr(CONSOLIDATE_SIZE, nullptr);
-        std::vector<FibonacciHeapNode*>tmp_arr;
+        this->tmp_arr.clear();
         FibonacciHeapNode *it=this->min;
         do{
-            tmp_arr.push_back(it);
+            this->tmp_arr.push_back(it);
             it=it->right_s;
         }while(it!=this->min);
         
-        for(FibonacciHeapNode* i : tmp_arr){
-            consolidate(i, consolidate_arr);
+        for(FibonacciHeapNode* i : this->tmp_arr){
+            consolidate(i, this->consolidate_arr);
         }
 
         this->min=nullptr;
 
         for(uint32_t i=0;i<CONSOLIDATE_SIZE;++i){
-            if(consolidate_arr[i]){
-                FibonacciHeapNode *ptr=consolidate_arr[i];
+            if(this->consolidate_arr[i]){
+                FibonacciHeapNode *ptr=this->consolidate_arr[i];
+                this->consolidate_arr[i]=nullptr;
                 if(this->min==nullptr){
                     addToList(ptr, this->min);
                     this->min=ptr;
@@ -589,10 +626,19 @@ public:
     }
 
     void unionize(FibonacciHeap *to_union) {
+        this->nodes.absorb(to_union->nodes);
         if(to_union->isEmpty()){
             delete to_union;
             return;
         }
+        if(this->isEmpty()){
+            this->min=to_union->min;
+            this->size=to_union->size;
+            to_union->min=nullptr;
+            to_union->size=0;
+            delete to_union;
+            return;
+        }
 
         FibonacciHeapNode *minPtr=to_union->min;
         FibonacciHeapNode *tmp1=to_union->min->left_s;
@@ -610,4 +656,286 @@ public:
     }
 };
 
+
+//radix heap for integer values, values can not be negative and have to be monotone: a new or decreased value can not be
+//smaller than the last extracted minimum (true for dijkstra and A_star with a consistent heuristic, not for prim)
+//a node is kept in the bucket given by the highest bit in which its value differs from the last minimum
+template<typename N>
+class RadixHeap : public Heap<N> {
+private:
+    static_assert(std::is_integral<N>::value, "RadixHeap needs integer values.");
+
+    struct RadixHeapNode{
+        uint32_t key;
+        N value;
+        uint32_t bucket;
+        uint32_t position;
+
+        RadixHeapNode(const uint32_t key, const N &value){
+            this->key=key;
+            this->value=value;
+            this->bucket=0;
+            this->position=0;
+        }
+    };
+
+    mutable std::vector<RadixHeapNode*>buckets[RADIX_HEAP_BUCKETS];
+    mutable N last;
+    uint32_t size;
+    NodePool<RadixHeapNode>nodes;
+
+    uint32_t bucketOf(const N &value) const{
+        return significantBits((uint64_t)value^(uint64_t)this->last);
+    }
+
+    void place(RadixHeapNode *ptr) const{
+        ptr->bucket=this->bucketOf(ptr->value);
+        ptr->position=this->buckets[ptr->bucket].size();
+        this->buckets[ptr->bucket].push_back(ptr);
+    }
+
+    void remove(RadixHeapNode *ptr){
+        std::vector<RadixHeapNode*> &b=this->buckets[ptr->bucket];
+        b[ptr->position]=b.back();
+        b[ptr->position]->position=ptr->position;
+        b.pop_back();
+    }
+
+    //moves the smallest values into bucket 0 by redistributing the first non-empty bucket around its minimum
+    void refill() const{
+        if(!this->buckets[0].empty()) return;
+        uint32_t i=1;
+        while(this->buckets[i].empty()) ++i;
+        RadixHeapNode *min=this->buckets[i][0];
+        for(RadixHeapNode *ptr : this->buckets[i]){
+            if(ptr->value<min->value) min=ptr;
+        }
+        this->last=min->value;
+        std::vector<RadixHeapNode*>tmp;
+        tmp.swap(this->buckets[i]);
+        for(RadixHeapNode *ptr : tmp) this->place(ptr);
+    }
+
+public:
+    RadixHeap(){
+        this->last=0;
+        this->size=0;
+    }
+
+    ~RadixHeap(){
+        for(uint32_t i=0;i<RADIX_HEAP_BUCKETS;++i){
+            for(RadixHeapNode *ptr : this->buckets[i]) this->nodes.destroy(ptr);
+        }
+    }
+
+    void setMaximumSize(const uint32_t maximum_size) override {
+        this->nodes.setLimit(maximum_size);
+    }
+
+    uint32_t getSize() const override {
+        return this->size;
+    }
+
+    bool isEmpty() const override {
+        return this->size==0;
+    }
+
+    std::pair<uint32_t, N> getMin() const override {
+        if(this->isEmpty()){
+            printErrorMsg(2, "Unable to get the smallest element from an empty radix heap.");
+        }
+        this->refill();
+        return std::pair<uint32_t, N>(this->buckets[0].back()->key, this->buckets[0].back()->value);
+    }
+
+    uint32_t extractMin() override {
+        if(this->isEmpty()){
+            printErrorMsg(2, "Trying to remove the smallest element from an empty radix heap.");
+        }
+        this->refill();
+        RadixHeapNode *ptr=this->buckets[0].back();
+        const uint32_t value_to_return=ptr->key;
+        this->buckets[0].pop_back();
+        this->nodes.destroy(ptr);
+        //an empty heap accepts any value again, so the heap can be reused by the next search
+        if(--this->size==0) this->last=0;
+        return value_to_return;
+    }
+
+    HeapNode insert(const uint32_t key, const N &value) override{
+        if(value<this->last){
+            printErrorMsg(2, "A value smaller than the last extracted minimum was inserted into a radix heap.");
+        }
+        RadixHeapNode *ptr=this->nodes.create(key, value);
+        this->place(ptr);
+        ++this->size;
+        return HeapNode((void*)ptr);
+    }
+
+    void decreaseValue(HeapNode *heap_node, const N &new_value) override{
+        if(!heap_node->getPtr()){
+            printErrorMsg(2, "DecreaseKey method in a class that represents radix heap received a pointer to NULL.");
+        }
+        RadixHeapNode *ptr=(RadixHeapNode*)heap_node->getPtr();
+        if(ptr->value<=new_value){
+            return;
+        }
+        if(new_value<this->last){
+            printErrorMsg(2, "A value in a radix heap was decreased below the last extracted minimum.");
+        }
+        this->remove(ptr);
+        ptr->value=new_value;
+        this->place(ptr);
+    }
+};
+
+//Dial's bucket queue for non-negative integer values: one doubly linked list of nodes per value in a circular array of buckets,
+//the array grows (to a power of two) when the difference between the largest and the smallest stored value does not fit in it
+//values do not have to be monotone, so it works for prim as well, but memory grows with the range of stored values
+template<typename N>
+class BucketQueue : public Heap<N> {
+private:
+    static_assert(std::is_integral<N>::value, "BucketQueue needs integer values.");
+
+    struct BucketQueueNode{
+        uint32_t key;
+        N value;
+        BucketQueueNode *prev;
+        BucketQueueNode *next;
+
+        BucketQueueNode(const uint32_t key, const N &value){
+            this->key=key;
+            this->value=value;
+            this->prev=this->next=nullptr;
+        }
+    };
+
+    std::vector<BucketQueueNode*>buckets;
+    mutable uint64_t base;
+    uint64_t top;
+    uint32_t size;
+    NodePool<BucketQueueNode>nodes;
+
+    void link(BucketQueueNode *ptr){
+        BucketQueueNode *&head=this->buckets[(uint64_t)ptr->value&(this->buckets.size()-1)];
+        ptr->prev=nullptr;
+        ptr->next=head;
+        if(head) head->prev=ptr;
+        head=ptr;
+    }
+
+    void unlink(BucketQueueNode *ptr){
+        if(ptr->prev) ptr->prev->next=ptr->next;
+        else this->buckets[(uint64_t)ptr->value&(this->buckets.size()-1)]=ptr->next;
+        if(ptr->next) ptr->next->prev=ptr->prev;
+    }
+
+    //makes room for value, all stored values have to stay within one turn of the circular array
+    void reserve(const uint64_t value){
+        if(this->size==0){
+            this->base=this->top=value;
+            return;
+        }
+        const uint64_t low=std::min(this->base, value);
+        const uint64_t high=std::max(this->top, value);
+        if(high-low>=this->buckets.size()){
+            uint64_t capacity=this->buckets.size();
+            while(capacity<=high-low) capacity*=2;
+            std::vector<BucketQueueNode*>old(capacity, nullptr);
+            old.swap(this->buckets);
+            for(BucketQueueNode *head : old){
+                while(head){
+                    BucketQueueNode *next=head->next;
+                    this->link(head);
+                    head=next;
+                }
+            }
+        }
+        this->base=low;
+        this->top=high;
+    }
+
+    BucketQueueNode *first() const{
+        while(!this->buckets[this->base&(this->buckets.size()-1)]) ++this->base;
+        return this->buckets[this->base&(this->buckets.size()-1)];
+    }
+
+public:
+    BucketQueue() : buckets(BUCKET_QUEUE_INITIAL_SIZE, nullptr){
+        this->base=0;
+        this->top=0;
+        this->size=0;
+    }
+
+    ~BucketQueue(){
+        for(BucketQueueNode *head : this->buckets){
+            while(head){
+                BucketQueueNode *next=head->next;
+                this->nodes.destroy(head);
+                head=next;
+            }
+        }
+    }
+
+    void setMaximumSize(const uint32_t maximum_size) override {
+        this->nodes.setLimit(maximum_size);
+    }
+
+    uint32_t getSize() const override {
+        return this->size;
+    }
+
+    bool isEmpty() const override {
+        return this->size==0;
+    }
+
+    std::pair<uint32_t, N> getMin() const override {
+        if(this->isEmpty()){
+            printErrorMsg(2, "Unable to get the smallest element from an empty bucket queue.");
+        }
+        BucketQueueNode *ptr=this->first();
+        return std::pair<uint32_t, N>(ptr->key, ptr->value);
+    }
+
+    uint32_t extractMin() override {
+        if(this->isEmpty()){
+            printErrorMsg(2, "Trying to remove the smallest element from an empty bucket queue.");
+        }
+        BucketQueueNode *ptr=this->first();
+        const uint32_t value_to_return=ptr->key;
+        this->unlink(ptr);
+        this->nodes.destroy(ptr);
+        --this->size;
+        return value_to_return;
+    }
+
+    HeapNode insert(const uint32_t key, const N &value) override{
+        if(std::is_signed<N>::value && value<N(0)){
+            printErrorMsg(2, "A negative value was inserted into a bucket queue.");
+        }
+        this->reserve(value);
+        BucketQueueNode *ptr=this->nodes.create(key, value);
+        this->link(ptr);
+        ++this->size;
+        return HeapNode((void*)ptr);
+    }
+
+    void decreaseValue(HeapNode *heap_node, const N &new_value) override{
+        if(!heap_node->getPtr()){
+            printErrorMsg(2, "DecreaseKey method in a class that represents bucket queue received a pointer to NULL.");
+        }
+        BucketQueueNode *ptr=(BucketQueueNode*)heap_node->getPtr();
+        if(ptr->value<=new_value){
+            return;
+        }
+        if(std::is_signed<N>::value && new_value<N(0)){
+            printErrorMsg(2, "A value in a bucket queue was decreased below zero.");
+        }
+        this->unlink(ptr);
+        this->reserve(new_value);
+        ptr->value=new_value;
+        this->link(ptr);
+    }
+};
+
 #endif
@@ -0,0 +1,289 @@
+#ifndef NEIGHBOUR_RANGE_H
+#define NEIGHBOUR_RANGE_H
+
+#include <cstdint>
+#include <utility>
+#include "bit_matrix.h"
+
+class NeighbourRange{
+private:
+    const uint32_t *first;
+    const uint32_t *last;
+public:
+    NeighbourRange(const uint32_t *first, const uint32_t *last){
+        this->first=first;
+        this->last=last;
+    }
+
+    const uint32_t *begin() const{
+        return this->first;
+    }
+
+    const uint32_t *end() const{
+        return this->last;
+    }
+
+    uint32_t size() const{
+        return this->last-this->first;
+    }
+
+    bool empty() const{
+        return this->first==this->last;
+    }
+
+    uint32_t operator[](const uint32_t idx) const{
+        return this->first[idx];
+    }
+};
+
+template<typename N>
+class WeightedNeighbourRange{
+private:
+    const uint32_t *targets;
+    const N *weights;
+    uint32_t length;
+public:
+    class iterator{
+    private:
+        const uint32_t *target;
+        const N *weight;
+    public:
+        iterator(const uint32_t *target, const N *weight){
+            this->target=target;
+            this->weight=weight;
+        }
+
+        std::pair<uint32_t, N> operator*() const{
+            return std::pair<uint32_t, N>(*this->target, *this->weight);
+        }
+
+        iterator& operator++(){
+            ++this->target;
+            ++this->weight;
+            return *this;
+        }
+
+        bool operator==(const iterator &other) const{
+            return this->target==other.target;
+        }
+
+        bool operator!=(const iterator &other) const{
+            return this->target!=other.target;
+        }
+    };
+
+    WeightedNeighbourRange(const uint32_t *targets, const N *weights, const uint32_t length){
+        this->targets=targets;
+        this->weights=weights;
+        this->length=length;
+    }
+
+    iterator begin() const{
+        return iterator(this->targets, this->weights);
+    }
+
+    iterator end() const{
+        return iterator(this->targets+this->length, this->weights+this->length);
+    }
+
+    uint32_t size() const{
+        return this->length;
+    }
+
+    bool empty() const{
+        return this->length==0;
+    }
+
+    const uint32_t *getTargets() const{
+        return this->targets;
+    }
+
+    const N *getWeights() const{
+        return this->weights;
+    }
+};
+
+//walks a contiguous row of a weighted adjacency matrix and skips cells equal to max
+template<typename N>
+class DenseRowTargetRange{
+private:
+    const N *row;
+    uint32_t length;
+    N max;
+public:
+    class iterator{
+    private:
+        const N *row;
+        uint32_t length;
+        uint32_t idx;
+        N max;
+
+        void skip(){
+            while(this->idx<this->length && this->row[this->idx]==this->max) ++this->idx;
+        }
+    public:
+        iterator(const N *row, const uint32_t length, const uint32_t idx, const N &max){
+            this->row=row;
+            this->length=length;
+            this->idx=idx;
+            this->max=max;
+            this->skip();
+        }
+
+        uint32_t operator*() const{
+            return this->idx;
+        }
+
+        iterator& operator++(){
+            ++this->idx;
+            this->skip();
+            return *this;
+        }
+
+        bool operator==(const iterator &other) const{
+            return this->idx==other.idx;
+        }
+
+        bool operator!=(const iterator &other) const{
+            return this->idx!=other.idx;
+        }
+    };
+
+    DenseRowTargetRange(const N *row, const uint32_t length, const N &max){
+        this->row=row;
+        this->length=length;
+        this->max=max;
+    }
+
+    iterator begin() const{
+        return iterator(this->row, this->length, 0, this->max);
+    }
+
+    iterator end() const{
+        return iterator(this->row, this->length, this->length, this->max);
+    }
+};
+
+//same as DenseRowTargetRange, but yields pairs (vertex, weight)
+template<typename N>
+class DenseRowRange{
+private:
+    const N *row;
+    uint32_t length;
+    N max;
+public:
+    class iterator{
+    private:
+        const N *row;
+        uint32_t length;
+        uint32_t idx;
+        N max;
+
+        void skip(){
+            while(this->idx<this->length && this->row[this->idx]==this->max) ++this->idx;
+        }
+    public:
+        iterator(const N *row, const uint32_t length, const uint32_t idx, const N &max){
+            this->row=row;
+            this->length=length;
+            this->idx=idx;
+            this->max=max;
+            this->skip();
+        }
+
+        std::pair<uint32_t, N> operator*() const{
+            return std::pair<uint32_t, N>(this->idx, this->row[this->idx]);
+        }
+
+        iterator& operator++(){
+            ++this->idx;
+            this->skip();
+            return *this;
+        }
+
+        bool operator==(const iterator &other) const{
+            return this->idx==other.idx;
+        }
+
+        bool operator!=(const iterator &other) const{
+            return this->idx!=other.idx;
+        }
+    };
+
+    DenseRowRange(const N *row, const uint32_t length, const N &max){
+        this->row=row;
+        this->length=length;
+        this->max=max;
+    }
+
+    iterator begin() const{
+        return iterator(this->row, this->length, 0, this->max);
+    }
+
+    iterator end() const{
+        return iterator(this->row, this->length, this->length, this->max);
+    }
+};
+
+//enumerates set bits of a matrix row one word at a time
+class BitRowRange{
+private:
+    const uint64_t *words;
+    uint32_t length;
+public:
+    class iterator{
+    private:
+        const uint64_t *words;
+        uint32_t length;
+        uint32_t word_idx;
+        uint64_t bits;
+
+        void skip(){
+            while(this->bits==0 && this->word_idx<this->length){
+                ++this->word_idx;
+                if(this->word_idx<this->length) this->bits=this->words[this->word_idx];
+            }
+        }
+    public:
+        iterator(const uint64_t *words, const uint32_t length, const uint32_t word_idx){
+            this->words=words;
+            this->length=length;
+            this->word_idx=word_idx;
+            this->bits=word_idx<length ? words[word_idx] : 0;
+            this->skip();
+        }
+
+        uint32_t operator*() const{
+            return this->word_idx*64+countTrailingZeros(this->bits);
+        }
+
+        iterator& operator++(){
+            this->bits&=this->bits-1;
+            this->skip();
+            return *this;
+        }
+
+        bool operator==(const iterator &other) const{
+            return this->word_idx==other.word_idx && this->bits==other.bits;
+        }
+
+        bool operator!=(const iterator &other) const{
+            return !(*this==other);
+        }
+    };
+
+    BitRowRange(const uint64_t *words, const uint32_t length){
+        this->words=words;
+        this->length=length;
+    }
+
+    iterator begin() const{
+        return iterator(this->words, this->length, 0);
+    }
+
+    iterator end() const{
+        return iterator(this->words, this->length, this->length);
+    }
+};
+
+#endif
@@ -0,0 +1,108 @@
+#ifndef NODE_POOL_H
+#define NODE_POOL_H
+
+#include <cstdint>
+#include <vector>
+#include <new>
+#include <utility>
+#include <algorithm>
+
+#define NODE_POOL_FIRST_SLAB 64
+
+//slab allocator for objects of one type: slots are cut from slabs that double in size and released slots are reused first,
+//so creating and destroying nodes does not go through the global allocator once the pool has warmed up
+//setLimit bounds the total size of slabs when the caller knows how many objects can be alive at once
+template<typename T>
+class NodePool{
+private:
+    union Slot{
+        Slot *next;
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+    std::vector<Slot*>slabs;
+    Slot *free_list;
+    Slot *current;
+    uint32_t used;
+    uint32_t capacity;
+    uint64_t allocated;
+    uint64_t limit;
+
+    void release(Slot *slot){
+        slot->next=this->free_list;
+        this->free_list=slot;
+    }
+
+    void addSlab(){
+        uint64_t count=this->slabs.empty() ? NODE_POOL_FIRST_SLAB : this->allocated;
+        if(this->limit>this->allocated) count=std::min(count, this->limit-this->allocated);
+        count=std::max<uint64_t>(count, 1);
+        for(uint32_t i=this->used;i<this->capacity;++i) this->release(&this->current[i]);
+        this->current=new Slot[count];
+        this->slabs.push_back(this->current);
+        this->used=0;
+        this->capacity=count;
+        this->allocated+=count;
+    }
+
+public:
+    NodePool(){
+        this->free_list=nullptr;
+        this->current=nullptr;
+        this->used=0;
+        this->capacity=0;
+        this->allocated=0;
+        this->limit=0;
+    }
+
+    NodePool(const NodePool&)=delete;
+    NodePool& operator=(const NodePool&)=delete;
+
+    //memory is released without calling destructors, objects that own resources have to be destroyed first
+    ~NodePool(){
+        for(Slot *slab : this->slabs) delete[] slab;
+    }
+
+    //the largest number of slots the pool should ever need, 0 - no limit
+    void setLimit(const uint64_t limit){
+        this->limit=limit;
+    }
+
+    template<typename... Args>
+    T *create(Args&&... args){
+        Slot *slot;
+        if(this->free_list){
+            slot=this->free_list;
+            this->free_list=slot->next;
+        }
+        else{
+            if(this->used==this->capacity) this->addSlab();
+            slot=&this->current[this->used++];
+        }
+        return new(slot->storage) T(std::forward<Args>(args)...);
+    }
+
+    void destroy(T *ptr){
+        ptr->~T();
+        this->release((Slot*)(void*)ptr);
+    }
+
+    //takes over every slab of other (used when two heaps are merged, so nodes of other stay valid)
+    void absorb(NodePool &other){
+        for(uint32_t i=other.used;i<other.capacity;++i) this->release(&other.current[i]);
+        while(other.free_list){
+            Slot *slot=other.free_list;
+            other.free_list=slot->next;
+            this->release(slot);
+        }
+        this->slabs.insert(this->slabs.end(), other.slabs.begin(), other.slabs.end());
+        this->allocated+=other.allocated;
+        if(this->limit && other.limit) this->limit+=other.limit;
+        other.slabs.clear();
+        other.current=nullptr;
+        other.used=other.capacity=0;
+        other.allocated=0;
+    }
+};
+
+#endif
@@ -1,7 +1,11 @@
 #ifndef PQ_H
 #define PQ_H
 #include <vector>
+#include <cstdint>
+#include <algorithm>
+#include <utility>
 #include "heap_node.h"
+#include "error_info.h"
 
 template<typename H, typename N>
 class Priority_Q {
@@ -12,6 +16,7 @@ private:
 public:
     Priority_Q(uint32_t maximum_size) {
         h=new H();
+        h->setMaximumSize(maximum_size);
         this->max_size=maximum_size;
         v=std::vector<HeapNode>(maximum_size, HeapNode());
     }
@@ -46,6 +51,199 @@ public:
         uint32_t index=h->extractMin();
         v[index]=HeapNode(nullptr);
     }
+
+    //removes every element, the cost depends only on the number of elements left in the heap
+    void clear() {
+        while(!h->isEmpty()) this->pop();
+    }
+};
+
+
+#define DARY_HEAP_NOT_IN_HEAP UINT32_MAX
+
+//indexed d-ary heap with the interface of Priority_Q, (key, value) pairs are stored directly in one array
+//and position holds the index of every key in it, so nothing is allocated per element; D children per node (e.g. 4 or 8)
+template<typename N, uint32_t D=4>
+class IndexedDaryHeap {
+private:
+    static_assert(D>=2, "IndexedDaryHeap needs at least two children per node.");
+
+    std::vector<std::pair<uint32_t, N>>heap;
+    std::vector<uint32_t>position;
+
+    void siftUp(uint32_t index){
+        const std::pair<uint32_t, N> element=this->heap[index];
+        while(index!=0){
+            const uint32_t parent=(index-1)/D;
+            if(!(element.second<this->heap[parent].second)) break;
+            this->heap[index]=this->heap[parent];
+            this->position[this->heap[index].first]=index;
+            index=parent;
+        }
+        this->heap[index]=element;
+        this->position[element.first]=index;
+    }
+
+    void siftDown(uint32_t index){
+        const std::pair<uint32_t, N> element=this->heap[index];
+        const uint32_t size=this->heap.size();
+        while(true){
+            const uint32_t first=index*D+1;
+            if(first>=size) break;
+            const uint32_t last=std::min(first+D, size);
+            uint32_t smallest=first;
+            for(uint32_t i=first+1;i<last;++i){
+                if(this->heap[i].second<this->heap[smallest].second) smallest=i;
+            }
+            if(!(this->heap[smallest].second<element.second)) break;
+            this->heap[index]=this->heap[smallest];
+            this->position[this->heap[index].first]=index;
+            index=smallest;
+        }
+        this->heap[index]=element;
+        this->position[element.first]=index;
+    }
+
+public:
+    IndexedDaryHeap(uint32_t maximum_size) : position(maximum_size, DARY_HEAP_NOT_IN_HEAP){}
+
+    std::pair<uint32_t, N> top() const{
+        if(this->heap.empty()){
+            printErrorMsg(2, "Unable to get the smallest element from an empty d-ary heap.");
+        }
+        return this->heap[0];
+    }
+
+    bool empty() const{
+        return this->heap.empty();
+    }
+
+    uint32_t size() const{
+        return this->heap.size();
+    }
+
+    //inserts node or decreases its value, a value that is not smaller than the current one is ignored
+    void push(const uint32_t node, const N value){
+        const uint32_t index=this->position[node];
+        if(index!=DARY_HEAP_NOT_IN_HEAP){
+            if(value<this->heap[index].second){
+                this->heap[index].second=value;
+                this->siftUp(index);
+            }
+            return;
+        }
+        this->heap.push_back(std::pair<uint32_t, N>(node, value));
+        this->siftUp(this->heap.size()-1);
+    }
+
+    void pop(){
+        if(this->heap.empty()){
+            printErrorMsg(2, "Trying to remove the smallest element from an empty d-ary heap.");
+        }
+        this->position[this->heap[0].first]=DARY_HEAP_NOT_IN_HEAP;
+        if(this->heap.size()>1){
+            this->heap[0]=this->heap.back();
+            this->heap.pop_back();
+            this->siftDown(0);
+        }
+        else{
+            this->heap.pop_back();
+        }
+    }
+
+    void clear(){
+        for(const auto &e : this->heap) this->position[e.first]=DARY_HEAP_NOT_IN_HEAP;
+        this->heap.clear();
+    }
+
+    //allows nodes in <0;maximum_size), elements already in the heap are kept
+    void resize(const uint32_t maximum_size){
+        if(maximum_size>this->position.size()) this->position.resize(maximum_size, DARY_HEAP_NOT_IN_HEAP);
+    }
+};
+
+//priority queue with the interface of Priority_Q that never decreases a key in place: push() of a smaller value appends
+//another entry to a contiguous binary heap and entries that are no longer current are skipped when they reach the top,
+//so there are no handles and no per-node position to keep up to date; the heap may hold up to one entry per push()
+template<typename N>
+class LazyPriority_Q {
+private:
+    struct Greater{
+        bool operator()(const std::pair<uint32_t, N> &a, const std::pair<uint32_t, N> &b) const{
+            return b.second<a.second;
+        }
+    };
+
+    std::vector<std::pair<uint32_t, N>>heap;
+    std::vector<N>current;
+    std::vector<uint8_t>in_queue;
+    uint32_t number_of_keys;
+
+    //an entry is stale if its key is not in the queue or its value is not the current one (the key was pushed again
+    //with a smaller value, or popped and pushed again with a different one)
+    bool isStale(const std::pair<uint32_t, N> &entry) const{
+        const N &value=this->current[entry.first];
+        return !this->in_queue[entry.first] || value<entry.second || entry.second<value;
+    }
+
+    void removeStale(){
+        while(!this->heap.empty() && this->isStale(this->heap.front())){
+            std::pop_heap(this->heap.begin(), this->heap.end(), Greater());
+            this->heap.pop_back();
+        }
+    }
+
+public:
+    LazyPriority_Q(uint32_t maximum_size) : current(maximum_size), in_queue(maximum_size, 0){
+        this->number_of_keys=0;
+    }
+
+    std::pair<uint32_t, N> top() const{
+        if(this->number_of_keys==0){
+            printErrorMsg(2, "Unable to get the smallest element from an empty lazy priority queue.");
+        }
+        return this->heap.front();
+    }
+
+    bool empty() const{
+        return this->number_of_keys==0;
+    }
+
+    //number of keys in the queue, stale entries are not counted
+    uint32_t size() const{
+        return this->number_of_keys;
+    }
+
+    //inserts node or lowers its value, a value that is not smaller than the current one is ignored
+    void push(const uint32_t node, const N value){
+        if(this->in_queue[node]){
+            if(!(value<this->current[node])) return;
+        }
+        else{
+            this->in_queue[node]=1;
+            ++this->number_of_keys;
+        }
+        this->current[node]=value;
+        this->heap.push_back(std::pair<uint32_t, N>(node, value));
+        std::push_heap(this->heap.begin(), this->heap.end(), Greater());
+    }
+
+    void pop(){
+        if(this->number_of_keys==0){
+            printErrorMsg(2, "Trying to remove the smallest element from an empty lazy priority queue.");
+        }
+        this->in_queue[this->heap.front().first]=0;
+        --this->number_of_keys;
+        std::pop_heap(this->heap.begin(), this->heap.end(), Greater());
+        this->heap.pop_back();
+        this->removeStale();
+    }
+
+    void clear(){
+        for(const auto &e : this->heap) this->in_queue[e.first]=0;
+        this->heap.clear();
+        this->number_of_keys=0;
+    }
 };
 
 #endif
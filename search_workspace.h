@@ -0,0 +1,111 @@
+#ifndef SEARCH_WORKSPACE_H
+#define SEARCH_WORKSPACE_H
+
+#include <cstdint>
+#include <vector>
+#include <algorithm>
+
+//queue type for workspaces that are only used by bfs, it keeps the interface of a PQ constructor and clear()
+struct NoQueue{
+    explicit NoQueue(uint32_t){}
+    void clear(){}
+};
+
+//buffers of a single-source search kept between queries: distances, parents, visited flags, the priority queue
+//and the bfs queue; entries are valid only if they carry the current stamp, so reset() does not touch O(V) memory
+//(apart from the rare wrap-around of the stamp) and clears only the elements that are still in the priority queue
+template<typename N, typename PQ=NoQueue>
+class SearchWorkspace{
+private:
+    struct Entry{
+        N distance;
+        uint32_t parent;
+        uint32_t reached;
+        uint32_t settled;
+        uint32_t marked;
+    };
+
+    std::vector<Entry>entries;
+    std::vector<uint32_t>vertex_queue;
+    PQ pq;
+    uint32_t stamp;
+
+public:
+    explicit SearchWorkspace(const uint32_t size) : entries(size, Entry{N(), UINT32_MAX, 0, 0, 0}), pq(size){
+        this->stamp=0;
+    }
+
+    SearchWorkspace(const SearchWorkspace&)=delete;
+    SearchWorkspace& operator=(const SearchWorkspace&)=delete;
+
+    uint32_t getSize() const{
+        return this->entries.size();
+    }
+
+    //forgets the previous search, called by every function that takes a workspace
+    void reset(){
+        if(++this->stamp==0){
+            for(Entry &e : this->entries) e.reached=e.settled=e.marked=0;
+            this->stamp=1;
+        }
+        this->pq.clear();
+        this->vertex_queue.clear();
+    }
+
+    bool isReached(const uint32_t vertex) const{
+        return this->entries[vertex].reached==this->stamp;
+    }
+
+    bool isSettled(const uint32_t vertex) const{
+        return this->entries[vertex].settled==this->stamp;
+    }
+
+    //valid only if isReached(vertex)
+    N getDistance(const uint32_t vertex) const{
+        return this->entries[vertex].distance;
+    }
+
+    //UINT32_MAX for the source and for vertexes that were not reached
+    uint32_t getParent(const uint32_t vertex) const{
+        return this->isReached(vertex) ? this->entries[vertex].parent : UINT32_MAX;
+    }
+
+    void reach(const uint32_t vertex, const N &distance, const uint32_t parent){
+        Entry &e=this->entries[vertex];
+        e.distance=distance;
+        e.parent=parent;
+        e.reached=this->stamp;
+    }
+
+    void settle(const uint32_t vertex){
+        this->entries[vertex].settled=this->stamp;
+    }
+
+    //marks are a per-search set of vertexes (used for the destinations of a search)
+    bool isMarked(const uint32_t vertex) const{
+        return this->entries[vertex].marked==this->stamp;
+    }
+
+    void mark(const uint32_t vertex){
+        this->entries[vertex].marked=this->stamp;
+    }
+
+    PQ& getQueue(){
+        return this->pq;
+    }
+
+    std::vector<uint32_t>& getVertexQueue(){
+        return this->vertex_queue;
+    }
+
+    //writes the path from the source of the last search to destination, returns false if destination was not reached
+    bool getPath(const uint32_t destination, std::vector<uint32_t> &path) const{
+        path.clear();
+        if(!this->isReached(destination)) return false;
+        for(uint32_t v=destination;v!=UINT32_MAX;v=this->entries[v].parent) path.push_back(v);
+        std::reverse(path.begin(), path.end());
+        return true;
+    }
+};
+
+#endif
@@ -0,0 +1,115 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <cstdint>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <algorithm>
+#include <atomic>
+
+//fixed group of threads for fork-join parallelism, run() executes a task on every thread and waits for all of them
+class ThreadPool{
+private:
+    std::vector<std::thread>workers;
+    std::mutex mutex;
+    std::condition_variable start_cv;
+    std::condition_variable done_cv;
+    std::function<void(uint32_t)>task;
+    uint64_t generation;
+    uint32_t pending;
+    bool stop;
+
+    void work(const uint32_t id){
+        uint64_t seen=0;
+        while(true){
+            {
+                std::unique_lock<std::mutex>lock(this->mutex);
+                this->start_cv.wait(lock, [&]{
+                    return this->stop || this->generation!=seen;
+                });
+                if(this->stop) return;
+                seen=this->generation;
+            }
+            this->task(id);
+            std::lock_guard<std::mutex>lock(this->mutex);
+            if(--this->pending==0) this->done_cv.notify_one();
+        }
+    }
+
+public:
+    //threads=0 uses std::thread::hardware_concurrency(), the calling thread is one of the threads
+    explicit ThreadPool(uint32_t threads=0){
+        if(threads==0) threads=std::max<uint32_t>(1, std::thread::hardware_concurrency());
+        this->generation=0;
+        this->pending=0;
+        this->stop=false;
+        for(uint32_t i=1;i<threads;++i) this->workers.push_back(std::thread(&ThreadPool::work, this, i));
+    }
+
+    ThreadPool(const ThreadPool&)=delete;
+    ThreadPool& operator=(const ThreadPool&)=delete;
+
+    ~ThreadPool(){
+        {
+            std::lock_guard<std::mutex>lock(this->mutex);
+            this->stop=true;
+        }
+        this->start_cv.notify_all();
+        for(auto &t : this->workers) t.join();
+    }
+
+    uint32_t getSize() const{
+        return this->workers.size()+1;
+    }
+
+    //calls task(thread_id) once on every thread, thread_id is in <0;getSize()), 0 is the calling thread
+    void run(const std::function<void(uint32_t)> &task){
+        if(this->workers.empty()){
+            task(0);
+            return;
+        }
+        {
+            std::lock_guard<std::mutex>lock(this->mutex);
+            this->task=task;
+            this->pending=this->workers.size();
+            ++this->generation;
+        }
+        this->start_cv.notify_all();
+        task(0);
+        std::unique_lock<std::mutex>lock(this->mutex);
+        this->done_cv.wait(lock, [&]{
+            return this->pending==0;
+        });
+    }
+};
+
+//splits <begin;end) into one contiguous block per thread and calls f(thread_id, block_begin, block_end)
+template<typename F>
+void parallelForBlocks(ThreadPool &pool, const uint64_t begin, const uint64_t end, const F &f){
+    const uint32_t threads=pool.getSize();
+    const uint64_t length=end>begin ? end-begin : 0;
+    pool.run([&](const uint32_t id){
+        const uint64_t b=begin+length*id/threads;
+        const uint64_t e=begin+length*(id+1)/threads;
+        if(b<e) f(id, b, e);
+    });
+}
+
+//splits <begin;end) into chunks of chunkSize indexes and calls f(chunk, chunk_begin, chunk_end) for every chunk (numbered from 0),
+//the chunks are handed out through an atomic counter, so a thread that drew expensive indexes does not hold up the others
+template<typename F>
+void parallelForChunks(ThreadPool &pool, const uint64_t begin, const uint64_t end, const uint64_t chunkSize, const F &f){
+    const uint64_t length=end>begin ? end-begin : 0;
+    const uint64_t chunks=(length+chunkSize-1)/chunkSize;
+    std::atomic<uint64_t>next(0);
+    pool.run([&](const uint32_t){
+        for(uint64_t c=next.fetch_add(1, std::memory_order_relaxed);c<chunks;c=next.fetch_add(1, std::memory_order_relaxed)){
+            f(c, begin+c*chunkSize, begin+std::min(length, (c+1)*chunkSize));
+        }
+    });
+}
+
+#endif
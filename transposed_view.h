@@ -0,0 +1,70 @@
+#ifndef TRANSPOSED_VIEW_H
+#define TRANSPOSED_VIEW_H
+
+#include <cstdint>
+#include <vector>
+#include <utility>
+#include "edge_list.h"
+#include "error_info.h"
+
+//read-only view of a directed graph with every edge reversed, G has to be created with keepInEdges
+//creating the view takes O(1) and the graph itself is not modified, so it can be used concurrently with other readers
+template<typename G>
+class TransposedView{
+private:
+    const G &g;
+public:
+    explicit TransposedView(const G &g) : g(g){
+        if(!g.hasInEdges()){
+            printErrorMsg(2, "A TransposedView can only be created for a graph that maintains its in-edges (keepInEdges).");
+        }
+    }
+
+    bool isDirected() const{
+        return g.isDirected();
+    }
+
+    bool isWeighted() const{
+        return g.isWeighted();
+    }
+
+    uint32_t getSize() const{
+        return g.getSize();
+    }
+
+    auto getMax() const{
+        return g.getMax();
+    }
+
+    bool areVertexesConnected(const uint32_t first, const uint32_t second) const{
+        return g.areVertexesConnected(second, first);
+    }
+
+    auto getWeight(const uint32_t first, const uint32_t second) const{
+        return g.getWeight(second, first);
+    }
+
+    const std::vector<uint32_t> getNeighbours(const uint32_t vertex) const{
+        return g.getInNeighbours(vertex);
+    }
+
+    auto getNeighboursWithWeights(const uint32_t vertex) const{
+        return g.getInNeighboursWithWeights(vertex);
+    }
+
+    auto getNeighboursRange(const uint32_t vertex) const{
+        return g.getInNeighboursRange(vertex);
+    }
+
+    auto getNeighboursWithWeightsRange(const uint32_t vertex) const{
+        return g.getInNeighboursWithWeightsRange(vertex);
+    }
+
+    auto getListOfEdges() const{
+        auto result=g.getListOfEdges();
+        for(auto &e : result) std::swap(edgeEndpoints(e).first, edgeEndpoints(e).second);
+        return result;
+    }
+};
+
+#endif